@@ -0,0 +1,233 @@
+/*******************************************************
+ * File Name: lm75_bench_cbor.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of the CBOR batch encoder against snprintf JSON, size and time per sample.
+ *              The CBOR output is decoded and checked against LM75_ConvertRaw.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_bench_cbor.c LM75/Src/lm75_cbor.c
+ *            LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c -lpthread
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#include "lm75_cbor.h"
+
+
+/* 64-sample batches of an 11-bit sensor, one read in FAIL_EVERY fails */
+#define BATCH               64
+#define BATCHES             100000UL
+#define FAIL_EVERY          100
+
+/* Output buffer, sent and reset when the next batch may not fit */
+#define OUT_SIZE            4096
+
+
+static uint16_t raw[BATCHES][BATCH];
+static LM75_Status status[BATCHES][BATCH];
+static uint8_t out[OUT_SIZE];
+
+/* Whole CBOR stream kept for the decoding check */
+static uint8_t *stream = NULL;
+static size_t stream_len = 0;
+
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Random walk around 25 degrees in 0.125 degree steps, fixed seed */
+static void generate(void)
+{
+    uint32_t seed = 12345;
+    int32_t value = 25 * 256;
+
+    for (unsigned long b = 0; b < BATCHES; b++)
+    {
+        for (uint16_t i = 0; i < BATCH; i++)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+
+            value += ((int32_t)(seed % 3) - 1) * 32;
+            value = (value < -40 * 256) ? -40 * 256 : (value > 100 * 256) ? 100 * 256 : value;
+            raw[b][i] = (uint16_t)(int16_t)value;
+            status[b][i] = (0 == (seed >> 8) % FAIL_EVERY) ? LM75_ERROR : LM75_OK;
+        }
+    }
+}
+
+/* Read one head, returns its major type and stores its argument */
+static int get_head(size_t *pos, uint32_t *value)
+{
+    uint8_t head = stream[(*pos)++];
+    uint8_t info = head & 0x1F;
+
+    *value = info;
+
+    if (24 == info)
+    {
+        *value = stream[(*pos)++];
+    }
+    else if (25 == info)
+    {
+        *value = ((uint32_t)stream[*pos] << 8) | stream[*pos + 1];
+        *pos += 2;
+    }
+    else if (26 == info)
+    {
+        *value = ((uint32_t)stream[*pos] << 24) | ((uint32_t)stream[*pos + 1] << 16) |
+                 ((uint32_t)stream[*pos + 2] << 8) | stream[*pos + 3];
+        *pos += 4;
+    }
+
+    return head >> 5;
+}
+
+/* Decode the stream and compare every sample with LM75_ConvertRaw, returns the number of mismatches */
+static unsigned long check(void)
+{
+    unsigned long bad = 0;
+    size_t pos = 0;
+
+    for (unsigned long b = 0; b < BATCHES; b++)
+    {
+        uint32_t v = 0;
+        int32_t exponent = 0;
+
+        /* map(3), 0: time, 1: exponent, 2: array */
+        bad += (5 != get_head(&pos, &v) || 3 != v);
+        get_head(&pos, &v);
+        get_head(&pos, &v);
+        bad += (b != v);
+        get_head(&pos, &v);
+        exponent = (1 == get_head(&pos, &v)) ? -1 - (int32_t)v : (int32_t)v;
+        get_head(&pos, &v);
+        bad += (4 != get_head(&pos, &v) || BATCH != v);
+
+        for (uint16_t i = 0; i < BATCH; i++)
+        {
+            int major = get_head(&pos, &v);
+            float expected = 0.0f;
+
+            if (7 == major)
+            {
+                bad += (LM75_OK == status[b][i] || 22 != v);
+                continue;
+            }
+
+            LM75_ConvertRaw(raw[b][i], LM75_11BIT, &expected);
+            bad += (LM75_OK != status[b][i]);
+            bad += ((float)((1 == major) ? -1 - (int32_t)v : (int32_t)v) * ((exponent < 0) ? 1.0f / (float)(1 << -exponent) : (float)(1 << exponent)) != expected);
+        }
+    }
+
+    bad += (pos != stream_len);
+
+    return bad;
+}
+
+int main(void)
+{
+    LM75_Cbor enc;
+    char json[BATCH * 10 + 64];
+    double start = 0.0;
+    double cbor_s = 0.0;
+    double json_s = 0.0;
+    unsigned long long cbor_bytes = 0;
+    unsigned long long json_bytes = 0;
+    double samples = (double)BATCHES * BATCH;
+    volatile uint8_t sink = 0;
+
+    stream = malloc(LM75_CBOR_BATCH_MAX(BATCH) * BATCHES);
+
+    if (NULL == stream)
+    {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    generate();
+
+    /* CBOR into a small buffer, copied out when full as a transport would */
+    LM75_Cbor_Init(&enc, out, sizeof(out));
+    start = now_s();
+
+    for (unsigned long b = 0; b < BATCHES; b++)
+    {
+        if (enc.size - enc.len < LM75_CBOR_BATCH_MAX(BATCH))
+        {
+            for (uint32_t i = 0; i < enc.len; i++)
+            {
+                stream[stream_len++] = out[i];
+            }
+
+            cbor_bytes += enc.len;
+            LM75_Cbor_Reset(&enc);
+        }
+
+        LM75_Cbor_EncodeBatch(&enc, (uint32_t)b, raw[b], status[b], BATCH, LM75_11BIT);
+    }
+
+    for (uint32_t i = 0; i < enc.len; i++)
+    {
+        stream[stream_len++] = out[i];
+    }
+
+    cbor_bytes += enc.len;
+    cbor_s = now_s() - start;
+
+    /* JSON of the same batches, degrees with three decimals, null for failed reads */
+    start = now_s();
+
+    for (unsigned long b = 0; b < BATCHES; b++)
+    {
+        int len = snprintf(json, sizeof(json), "{\"t\":%lu,\"v\":[", b);
+
+        for (uint16_t i = 0; i < BATCH; i++)
+        {
+            float temp = 0.0f;
+
+            if (LM75_OK != status[b][i] || LM75_OK != LM75_ConvertRaw(raw[b][i], LM75_11BIT, &temp))
+            {
+                len += snprintf(&json[len], sizeof(json) - (size_t)len, "null,");
+            }
+            else
+            {
+                len += snprintf(&json[len], sizeof(json) - (size_t)len, "%.3f,", (double)temp);
+            }
+        }
+
+        json[len - 1] = ']';
+        len += snprintf(&json[len], sizeof(json) - (size_t)len, "}");
+        json_bytes += (unsigned long long)len;
+        sink ^= (uint8_t)json[len / 2];
+    }
+
+    json_s = now_s() - start;
+
+    printf("%lu batches of %u 11-bit samples, 1 read in %u failed:\n", BATCHES, BATCH, FAIL_EVERY);
+    printf("  CBOR: %.2f bytes/sample, %6.1f ns/sample\n", (double)cbor_bytes / samples, cbor_s * 1e9 / samples);
+    printf("  JSON: %.2f bytes/sample, %6.1f ns/sample\n", (double)json_bytes / samples, json_s * 1e9 / samples);
+    printf("  CBOR decoding check: %lu mismatch(es)\n", check());
+
+    free(stream);
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/*******************************************************
+ * File Name: lm75_bench_eval.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of the batch Tos/Thyst evaluation kernel at 1k, 100k and 1M sensors.
+ *              Build once per kernel, the state hash must be the same for all of them.
+ *
+ * Build: gcc -O2 -std=c99 -ILM75/Inc LM75/Bench/lm75_bench_eval.c LM75/Src/lm75_eval.c -DLM75_EVAL_SCALAR
+ *        gcc -O2 -std=c99 -ILM75/Inc LM75/Bench/lm75_bench_eval.c LM75/Src/lm75_eval.c -msse2
+ *        gcc -O2 -std=c99 -ILM75/Inc LM75/Bench/lm75_bench_eval.c LM75/Src/lm75_eval.c -mavx2
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#include "lm75_eval.h"
+
+
+/* Readings evaluated per size, spread over FRAMES distinct input frames */
+#define READINGS            (256UL * 1000UL * 1000UL)
+#define FRAMES              8
+
+
+#if defined(LM75_EVAL_SCALAR)
+#define KERNEL              "scalar"
+#elif defined(__AVX2__)
+#define KERNEL              "avx2"
+#elif defined(__SSE2__)
+#define KERNEL              "sse2"
+#else
+#define KERNEL              "scalar"
+#endif
+
+
+static const uint32_t sizes[] = { 1000, 100000, 1000000 };
+
+
+static uint32_t seed = 12345;
+
+
+static uint32_t next_random(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return seed;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* FNV-1a over the state and the transition masks, equal for every kernel given the same input */
+static uint32_t hash(uint32_t h, const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        h = (h ^ bytes[i]) * 16777619UL;
+    }
+
+    return h;
+}
+
+/* Evaluate n sensors against thresholds around 60 degrees with readings crossing them */
+static int run(uint32_t n)
+{
+    uint32_t words = LM75_EVAL_WORDS(n);
+    int16_t *tos = malloc(sizeof(int16_t) * n);
+    int16_t *thyst = malloc(sizeof(int16_t) * n);
+    uint8_t *queue = malloc(n);
+    uint8_t *count = malloc(n);
+    uint32_t *active = malloc(sizeof(uint32_t) * words);
+    uint32_t *rising = malloc(sizeof(uint32_t) * words);
+    uint32_t *falling = malloc(sizeof(uint32_t) * words);
+    int16_t *temp = malloc(sizeof(int16_t) * n * FRAMES);
+    LM75_EvalSet set;
+    unsigned long calls = READINGS / n;
+    uint32_t h = 2166136261UL;
+    double start = 0.0;
+    double elapsed = 0.0;
+
+    if (NULL == tos || NULL == thyst || NULL == queue || NULL == count ||
+        NULL == active || NULL == rising || NULL == falling || NULL == temp)
+    {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    seed = 12345;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        tos[i] = (int16_t)((60 + (int32_t)(next_random() % 8)) * 256);
+        thyst[i] = (int16_t)(tos[i] - 5 * 256);
+        queue[i] = (uint8_t)(1 + next_random() % 6);
+    }
+
+    for (uint32_t i = 0; i < n * FRAMES; i++)
+    {
+        temp[i] = (int16_t)(50 * 256 + (int32_t)(next_random() % (25 * 256)));
+    }
+
+    set.n = n;
+    set.tos = tos;
+    set.thyst = thyst;
+    set.queue = queue;
+    set.count = count;
+    set.active = active;
+    LM75_Eval_Reset(&set);
+
+    start = now_s();
+
+    for (unsigned long c = 0; c < calls; c++)
+    {
+        LM75_Eval(&set, &temp[(c % FRAMES) * n], rising, falling);
+    }
+
+    elapsed = now_s() - start;
+
+    h = hash(h, count, n);
+    h = hash(h, active, sizeof(uint32_t) * words);
+    h = hash(h, rising, sizeof(uint32_t) * words);
+    h = hash(h, falling, sizeof(uint32_t) * words);
+
+    printf("  %7lu sensors: %8.1f M readings/s, state hash %08lx\n",
+           (unsigned long)n, (double)calls * n / elapsed * 1e-6, (unsigned long)h);
+
+    free(temp);
+    free(falling);
+    free(rising);
+    free(active);
+    free(count);
+    free(queue);
+    free(thyst);
+    free(tos);
+
+    return 0;
+}
+
+int main(void)
+{
+    printf("%s kernel, %lu readings per size:\n", KERNEL, READINGS);
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        if (0 != run(sizes[i]))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*******************************************************
+ * File Name: lm75_bench_fault.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of recovery from injected bus faults, per fault class.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -DLM75_FAULT_INJECTION -ILM75/Inc LM75/Bench/lm75_bench_fault.c
+ *            LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c LM75/Src/lm75_fault.c
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <stdio.h>
+
+
+#include "lm75.h"
+#include "lm75_fault.h"
+#include "lm75_sim.h"
+
+
+#define ADDR                0x48
+#define AMBIENT_C           25.0f
+
+/* Operations of the fault rate runs and their fault probability */
+#define RATE_OPS            100000UL
+#define RATE_PROB           0.01f
+
+/* Reads given to one scripted fault to recover */
+#define MAX_READS           16
+
+
+static const char *const names[LM75_FAULT_CLASSES] = { "none", "nack", "timeout", "arb_lost", "corrupt" };
+
+
+/* Sensor at a constant temperature without noise, so every correct reading is known */
+typedef struct {
+    LM75_SimDevice sdev;
+    struct LM75_SimBus bus;
+    LM75_Cold cold;
+    LM75 dev;
+    uint16_t expected;
+} Bench;
+
+
+static void bench_init(Bench *b)
+{
+    LM75_Sim_InitDevice(&b->sdev, ADDR, AMBIENT_C, 0.0f, 1000, 1);
+    b->sdev.noise = 0;
+    LM75_Sim_InitBus(&b->bus, &b->sdev, 1, 100000);
+    LM75_Init(&b->dev, &b->cold, &b->bus, NULL, LM75_11BIT, ADDR, 75.0f, 80.0f);
+    b->expected = (uint16_t)(int16_t)(AMBIENT_C * 256.0f) & 0xFFE0;
+}
+
+/* One Temp read, blocking or interrupt driven, true when it returned LM75_OK */
+static bool read_temp(LM75 *dev, bool async)
+{
+    if (!async)
+    {
+        return LM75_OK == LM75_GetTemperature(dev);
+    }
+
+    return LM75_OK == LM75_GetTemperature_Async(dev, NULL, NULL) && LM75_XFER_DONE == dev->xfer;
+}
+
+/* One scripted fault on a cached Temp read, then read until the value is correct */
+static void recover(LM75_FaultClass fault, bool async)
+{
+    uint8_t script[1] = { (uint8_t)fault };
+    LM75_FaultRule rule = { ADDR, LM75_TEMP_REG, LM75_FAULT_DIR_READ, 0, 0, script, 1, 0 };
+    LM75_FaultSet set;
+    Bench b;
+    uint32_t start = 0;
+    unsigned lost = 0;
+    unsigned wrong = 0;
+    unsigned reads = 0;
+
+    bench_init(&b);
+    read_temp(&b.dev, async);
+
+    LM75_Fault_Init(&set, &rule, 1, 1);
+    LM75_Fault_Install(&set);
+    start = b.bus.now_us;
+
+    while (reads < MAX_READS)
+    {
+        reads++;
+
+        if (!read_temp(&b.dev, async))
+        {
+            lost++;
+        }
+        else if (b.dev.temp_raw != b.expected)
+        {
+            wrong++;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    LM75_Fault_Install(NULL);
+
+    printf("  %-8s %-5s: %u read(s) lost, %u wrong value(s) returned OK, %lu us to recover\n",
+           names[fault], async ? "async" : "block", lost, wrong, (unsigned long)(b.bus.now_us - start));
+}
+
+/* RATE_OPS reads and RATE_OPS hysteresis writes with a fault probability on every transfer */
+static void rate(LM75_FaultClass fault)
+{
+    LM75_FaultRule rule = { LM75_FAULT_ANY, LM75_FAULT_ANY, LM75_FAULT_DIR_ANY, (uint8_t)fault, LM75_FAULT_PROB(RATE_PROB), NULL, 0, 0 };
+    LM75_FaultSet set;
+    Bench b;
+    unsigned long failed_reads = 0;
+    unsigned long wrong_reads = 0;
+    unsigned long failed_writes = 0;
+    unsigned long wrong_writes = 0;
+    uint32_t start = 0;
+
+    bench_init(&b);
+    LM75_Fault_Init(&set, &rule, 1, 12345);
+    LM75_Fault_Install(&set);
+    start = b.bus.now_us;
+
+    for (unsigned long i = 0; i < RATE_OPS; i++)
+    {
+        if (!read_temp(&b.dev, 0 != (i & 1)))
+        {
+            failed_reads++;
+        }
+        else if (b.dev.temp_raw != b.expected)
+        {
+            wrong_reads++;
+        }
+    }
+
+    for (unsigned long i = 0; i < RATE_OPS; i++)
+    {
+        float limit = (i & 1) ? 70.0f : 60.0f;
+
+        if (LM75_OK != LM75_SetHysteresis(&b.dev, limit))
+        {
+            failed_writes++;
+        }
+        else if (b.sdev.thyst != LM75_LIMIT_ENCODE(limit))
+        {
+            wrong_writes++;
+        }
+    }
+
+    LM75_Fault_Install(NULL);
+
+    printf("  %-8s: reads %.2f%% failed %.2f%% wrong, writes %.2f%% failed %.2f%% wrong, %.1f s bus time\n",
+           names[fault],
+           100.0 * failed_reads / RATE_OPS, 100.0 * wrong_reads / RATE_OPS,
+           100.0 * failed_writes / RATE_OPS, 100.0 * wrong_writes / RATE_OPS,
+           (double)(b.bus.now_us - start) * 1e-6);
+}
+
+int main(void)
+{
+    printf("One fault on a cached Temp read:\n");
+
+    for (int f = LM75_FAULT_NACK; f < LM75_FAULT_CLASSES; f++)
+    {
+        recover((LM75_FaultClass)f, false);
+        recover((LM75_FaultClass)f, true);
+    }
+
+    printf("%.0f%% fault rate over %lu operations (reads alternate blocking and async):\n", 100.0 * RATE_PROB, RATE_OPS);
+
+    for (int f = LM75_FAULT_NACK; f < LM75_FAULT_CLASSES; f++)
+    {
+        rate((LM75_FaultClass)f);
+    }
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*******************************************************
+ * File Name: lm75_bench_fleet.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of the unrolled fleet scan against a runtime loop over LM75 structs.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_bench_fleet.c
+ *            LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <stdio.h>
+#include <time.h>
+
+
+#include "lm75_sim.h"
+
+
+/* 16 sensors on two buses */
+#define LM75_FLEET(X) \
+    X(s0,  bus_a, 0x48, LM75_11BIT, 40.0f, 60.0f) \
+    X(s1,  bus_a, 0x49, LM75_11BIT, 40.0f, 60.0f) \
+    X(s2,  bus_a, 0x4A, LM75_11BIT, 40.0f, 60.0f) \
+    X(s3,  bus_a, 0x4B, LM75_11BIT, 40.0f, 60.0f) \
+    X(s4,  bus_a, 0x4C, LM75_9BIT,  50.0f, 80.0f) \
+    X(s5,  bus_a, 0x4D, LM75_9BIT,  50.0f, 80.0f) \
+    X(s6,  bus_a, 0x4E, LM75_9BIT,  50.0f, 80.0f) \
+    X(s7,  bus_a, 0x4F, LM75_9BIT,  50.0f, 80.0f) \
+    X(s8,  bus_b, 0x48, LM75_11BIT, 40.0f, 60.0f) \
+    X(s9,  bus_b, 0x49, LM75_11BIT, 40.0f, 60.0f) \
+    X(s10, bus_b, 0x4A, LM75_11BIT, 40.0f, 60.0f) \
+    X(s11, bus_b, 0x4B, LM75_11BIT, 40.0f, 60.0f) \
+    X(s12, bus_b, 0x4C, LM75_9BIT,  50.0f, 80.0f) \
+    X(s13, bus_b, 0x4D, LM75_9BIT,  50.0f, 80.0f) \
+    X(s14, bus_b, 0x4E, LM75_9BIT,  50.0f, 80.0f) \
+    X(s15, bus_b, 0x4F, LM75_9BIT,  50.0f, 80.0f)
+
+static LM75_Bus bus_a;
+static LM75_Bus bus_b;
+
+#include "lm75_fleet.h"
+
+
+#define ROUNDS              200000
+
+
+static LM75_SimDevice sim_a[8];
+static LM75_SimDevice sim_b[8];
+static LM75 fleet[LM75_FLEET_COUNT];
+static LM75_Cold fleet_cold[LM75_FLEET_COUNT];
+
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    double start = 0.0;
+    double unrolled = 0.0;
+    double loop = 0.0;
+    uint32_t errors = 0;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        LM75_Sim_InitDevice(&sim_a[i], (uint8_t)(0x48 + i), 25.0f, 0.5f, 2000, i + 1U);
+        LM75_Sim_InitDevice(&sim_b[i], (uint8_t)(0x48 + i), 30.0f, 0.5f, 2000, i + 9U);
+    }
+
+    LM75_Sim_InitBus(&bus_a, sim_a, 8, 400000);
+    LM75_Sim_InitBus(&bus_b, sim_b, 8, 400000);
+
+    if (LM75_OK != LM75_Fleet_Init(fleet, fleet_cold))
+    {
+        printf("init failed\n");
+        return 1;
+    }
+
+    /* Both scans read the same sensors, alternated so neither gets a warmer cache */
+    for (uint8_t pass = 0; pass < 2; pass++)
+    {
+        start = now_s();
+
+        for (uint32_t r = 0; r < ROUNDS; r++)
+        {
+            errors += (LM75_OK != LM75_Fleet_Scan(fleet)) ? 1U : 0U;
+        }
+
+        unrolled += now_s() - start;
+        start = now_s();
+
+        for (uint32_t r = 0; r < ROUNDS; r++)
+        {
+            for (uint16_t i = 0; i < LM75_FLEET_COUNT; i++)
+            {
+                errors += (LM75_OK != LM75_GetTemperature(&fleet[i])) ? 1U : 0U;
+            }
+        }
+
+        loop += now_s() - start;
+    }
+
+    printf("%u sensors, %u scans each: unrolled %.1f ns/sensor, runtime loop %.1f ns/sensor, errors %u\n",
+           (unsigned)LM75_FLEET_COUNT, 2U * ROUNDS,
+           unrolled * 1e9 / (2.0 * ROUNDS * LM75_FLEET_COUNT), loop * 1e9 / (2.0 * ROUNDS * LM75_FLEET_COUNT), (unsigned)errors);
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*******************************************************
+ * File Name: lm75_bench_layout.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of a scan over arrays of LM75 descriptors, for the descriptor layout.
+ *              The previous layout, with the bus lock and energy pointers in the descriptor, is
+ *              mirrored here so both are measured by the same binary.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_bench_layout.c
+ *            LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#include "lm75.h"
+
+
+/* Descriptors visited per fleet size */
+#define VISITS              200000000UL
+
+
+/* LM75 before the bus lock and energy pointers moved to LM75_Cold */
+typedef struct {
+    LM75_Bus *i2c;
+    LM75_BusLock *lock;
+    LM75_Energy *energy;
+    LM75_Cold *cold;
+    float temp_c;
+    uint16_t temp_raw;
+    uint8_t addr;
+    uint8_t ver;
+    uint8_t ptr;
+    volatile uint8_t xfer;
+} LM75_Before;
+
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Convert the last reading of every sensor, the fields a scan over the hot descriptor touches */
+#define SCAN(name, type) \
+static double name(const type *devs, size_t count) \
+{ \
+    unsigned long rounds = VISITS / count; \
+    volatile int64_t sink = 0; \
+    double start = now_s(); \
+ \
+    for (unsigned long r = 0; r < rounds; r++) \
+    { \
+        int64_t sum = 0; \
+ \
+        for (size_t i = 0; i < count; i++) \
+        { \
+            int16_t fixed = 0; \
+ \
+            LM75_ConvertRawFixed(devs[i].temp_raw, (LM75_Version)devs[i].ver, &fixed); \
+            sum += fixed + devs[i].addr; \
+        } \
+ \
+        sink += sum; \
+    } \
+ \
+    return (now_s() - start) * 1e9 / ((double)rounds * (double)count); \
+}
+
+SCAN(scan_before, LM75_Before)
+SCAN(scan, LM75)
+
+int main(void)
+{
+    static const size_t sizes[] = { 256, 100000, 1000000, 4000000 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        LM75_Before *before = calloc(sizes[s], sizeof(LM75_Before));
+        LM75 *devs = calloc(sizes[s], sizeof(LM75));
+
+        if (NULL == before || NULL == devs)
+        {
+            return 1;
+        }
+
+        for (size_t i = 0; i < sizes[s]; i++)
+        {
+            devs[i].temp_raw = before[i].temp_raw = (uint16_t)(i * 32U);
+            devs[i].addr = before[i].addr = (uint8_t)(0x90 + 2 * (i & 7));
+            devs[i].ver = before[i].ver = (uint8_t)(i & 1);
+        }
+
+        printf("%7zu sensors: previous %zu bytes per descriptor %.2f ns/sensor, current %zu bytes %.2f ns/sensor\n",
+               sizes[s], sizeof(LM75_Before), scan_before(before, sizes[s]), sizeof(LM75), scan(devs, sizes[s]));
+        free(devs);
+        free(before);
+    }
+
+    return 0;
+}
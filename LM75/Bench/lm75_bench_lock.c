@@ -0,0 +1,186 @@
+/*******************************************************
+ * File Name: lm75_bench_lock.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of bus lock contention with the POSIX port: threads reading sensors
+ *              on one shared bus against the same threads on one bus each.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -DLM75_OS=LM75_OS_POSIX -ILM75/Inc LM75/Bench/lm75_bench_lock.c
+ *            LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c -lpthread
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+
+
+#include "lm75_sim.h"
+
+
+#if LM75_OS != LM75_OS_POSIX
+#error "Build with -DLM75_OS=LM75_OS_POSIX"
+#endif
+
+
+#define MAX_THREADS         4
+
+/* Host time each thread reads for */
+#define DURATION_S          1.0
+
+
+static const uint8_t sweep[] = { 1, 2, 4 };
+
+
+/* One reading thread and its sensor */
+typedef struct {
+    pthread_t thread;
+    LM75 *dev;
+    double end;
+    unsigned long reads;
+    unsigned long errors;
+} Reader;
+
+
+static LM75_SimDevice sdevs[MAX_THREADS];
+static LM75_Bus buses[MAX_THREADS];
+static LM75_BusLock locks[MAX_THREADS];
+static LM75 devs[MAX_THREADS];
+static LM75_Cold colds[MAX_THREADS];
+
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Read the sensor of the thread until the end time */
+static void *run_reader(void *arg)
+{
+    Reader *reader = (Reader *)arg;
+
+    while (now_s() < reader->end)
+    {
+        if (LM75_OK == LM75_GetTemperature(reader->dev))
+        {
+            reader->reads++;
+        }
+        else
+        {
+            reader->errors++;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Set up MAX_THREADS sensors, all on bus 0 under one lock when shared, else one bus and lock each.
+ * Every transfer sleeps for its bus time, so a thread holding the lock keeps the others waiting.
+ */
+static int setup(bool shared)
+{
+    for (uint8_t i = 0; i < MAX_THREADS; i++)
+    {
+        LM75_Sim_InitDevice(&sdevs[i], (uint8_t)(0x48 + i), 25.0f, 0.5f, 2000, i + 1U);
+    }
+
+    for (uint8_t b = 0; b < MAX_THREADS; b++)
+    {
+        LM75_Sim_InitBus(&buses[b], shared ? sdevs : &sdevs[b], shared ? MAX_THREADS : 1, 400000);
+        buses[b].realtime = true;
+    }
+
+    for (uint8_t i = 0; i < MAX_THREADS; i++)
+    {
+        uint8_t b = shared ? 0 : i;
+
+        if (LM75_OK != LM75_Init(&devs[i], &colds[i], &buses[b], &locks[b], LM75_11BIT, (uint8_t)(0x48 + i), 40.0f, 60.0f))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Total reads per second of threads readers, one sensor each */
+static double run(uint8_t threads, unsigned long *errors)
+{
+    Reader readers[MAX_THREADS];
+    double start = now_s();
+    unsigned long reads = 0;
+
+    *errors = 0;
+
+    for (uint8_t t = 0; t < threads; t++)
+    {
+        readers[t].dev = &devs[t];
+        readers[t].end = start + DURATION_S;
+        readers[t].reads = 0;
+        readers[t].errors = 0;
+        pthread_create(&readers[t].thread, NULL, run_reader, &readers[t]);
+    }
+
+    for (uint8_t t = 0; t < threads; t++)
+    {
+        pthread_join(readers[t].thread, NULL);
+        reads += readers[t].reads;
+        *errors += readers[t].errors;
+    }
+
+    return (double)reads / (now_s() - start);
+}
+
+int main(void)
+{
+    for (uint8_t i = 0; i < MAX_THREADS; i++)
+    {
+        if (!LM75_OS_LockInit(&locks[i]))
+        {
+            printf("lock init failed\n");
+            return 1;
+        }
+    }
+
+    printf("Blocking Temp reads at 400 kHz, transfers sleep for their bus time:\n");
+
+    for (uint8_t s = 0; s < sizeof(sweep); s++)
+    {
+        unsigned long shared_errors = 0;
+        unsigned long split_errors = 0;
+        double shared = 0.0;
+        double split = 0.0;
+
+        if (0 != setup(true))
+        {
+            printf("init failed\n");
+            return 1;
+        }
+
+        shared = run(sweep[s], &shared_errors);
+
+        if (0 != setup(false))
+        {
+            printf("init failed\n");
+            return 1;
+        }
+
+        split = run(sweep[s], &split_errors);
+
+        printf("  %u thread(s): one shared bus lock %7.1f k reads/s, one lock per bus %7.1f k reads/s, %lu errors\n",
+               sweep[s], shared * 1e-3, split * 1e-3, shared_errors + split_errors);
+    }
+
+    return 0;
+}
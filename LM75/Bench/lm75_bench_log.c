@@ -0,0 +1,188 @@
+/*******************************************************
+ * File Name: lm75_bench_log.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of the compressed sample log: bytes per sample, ingest and decode rates
+ *              of one 11-bit sensor read every second, with an exact period and with +-1 ms jitter.
+ *              Every decoded sample is checked against the input.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_bench_log.c LM75/Src/lm75_log.c
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+#include "lm75_log.h"
+
+
+#define SAMPLES             10000000UL
+#define PERIOD_MS           1000
+
+/* Size of a sample stored as a row: 64-bit timestamp and double value */
+#define ROW_SIZE            16
+
+
+/* Log written by the sink */
+typedef struct {
+    uint8_t *data;
+    size_t len;
+    size_t size;
+} Buffer;
+
+
+static uint32_t seed = 12345;
+
+
+static uint32_t next_random(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return seed;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static LM75_Status write_buffer(void *ctx, const uint8_t *data, uint32_t len)
+{
+    Buffer *buf = (Buffer *)ctx;
+
+    if (buf->size - buf->len < len)
+    {
+        return LM75_ERROR;
+    }
+
+    memcpy(&buf->data[buf->len], data, len);
+    buf->len += len;
+
+    return LM75_OK;
+}
+
+/* Slow random walk around 25 degrees in 0.125 degree steps, one step in 16 samples on average */
+static void generate(uint32_t *ts, uint16_t *raw, uint32_t jitter_ms)
+{
+    int32_t value = 25 * 256;
+
+    seed = 12345;
+
+    for (unsigned long i = 0; i < SAMPLES; i++)
+    {
+        uint32_t r = next_random();
+
+        ts[i] = (uint32_t)(i * PERIOD_MS);
+
+        if (jitter_ms > 0)
+        {
+            ts[i] += (uint32_t)((int32_t)((r >> 8) % (2 * jitter_ms + 1)) - (int32_t)jitter_ms);
+        }
+
+        if (0 == r % 16)
+        {
+            value += (0 != (r & 0x10)) ? 32 : -32;
+            value = (value < -40 * 256) ? -40 * 256 : (value > 100 * 256) ? 100 * 256 : value;
+        }
+
+        raw[i] = (uint16_t)(int16_t)value;
+    }
+}
+
+/* Encode and decode the samples, returns the number of decoded samples differing from the input */
+static unsigned long run(const char *name, const uint32_t *ts, const uint16_t *raw, Buffer *buf)
+{
+    LM75_LogWriter writer;
+    LM75_LogReader reader;
+    unsigned long bad = 0;
+    unsigned long n = 0;
+    uint32_t t = 0;
+    uint16_t r = 0;
+    double encode_s = 0.0;
+    double decode_s = 0.0;
+    double start = 0.0;
+
+    buf->len = 0;
+    start = now_s();
+    LM75_Log_WriterInit(&writer, LM75_11BIT, write_buffer, buf);
+
+    for (unsigned long i = 0; i < SAMPLES; i++)
+    {
+        if (LM75_OK != LM75_Log_Append(&writer, ts[i], raw[i]))
+        {
+            return SAMPLES;
+        }
+    }
+
+    if (LM75_OK != LM75_Log_Flush(&writer))
+    {
+        return SAMPLES;
+    }
+
+    encode_s = now_s() - start;
+
+    start = now_s();
+    LM75_Log_ReaderInit(&reader, buf->data, buf->len);
+
+    while (LM75_Log_Next(&reader, &t, &r))
+    {
+        bad += (n >= SAMPLES || ts[n] != t || raw[n] != r);
+        n++;
+    }
+
+    decode_s = now_s() - start;
+    bad += (SAMPLES != n) || reader.corrupt;
+
+    printf("  %-14s %.3f bytes/sample, ingest %5.1f M samples/s (%4.0f MB/s of %u-byte rows), decode %5.1f M samples/s\n",
+           name, (double)buf->len / SAMPLES, SAMPLES / encode_s * 1e-6, SAMPLES * ROW_SIZE / encode_s * 1e-6, ROW_SIZE,
+           SAMPLES / decode_s * 1e-6);
+
+    return bad;
+}
+
+int main(void)
+{
+    uint32_t *ts = malloc(sizeof(uint32_t) * SAMPLES);
+    uint16_t *raw = malloc(sizeof(uint16_t) * SAMPLES);
+    Buffer buf = { NULL, 0, 4 * SAMPLES };
+    unsigned long bad = 0;
+
+    buf.data = malloc(buf.size);
+
+    if (NULL == ts || NULL == raw || NULL == buf.data)
+    {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    printf("%lu samples of one 11-bit sensor every %u ms, %u-sample blocks:\n", SAMPLES, PERIOD_MS, LM75_LOG_BLOCK_SAMPLES);
+
+    generate(ts, raw, 0);
+    bad += run("exact period:", ts, raw, &buf);
+
+    generate(ts, raw, 1);
+    bad += run("+-1 ms jitter:", ts, raw, &buf);
+
+    printf("  %lu sample(s) decoded wrong\n", bad);
+
+    free(buf.data);
+    free(raw);
+    free(ts);
+
+    return (0 != bad);
+}
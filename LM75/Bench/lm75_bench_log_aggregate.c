@@ -0,0 +1,235 @@
+/*******************************************************
+ * File Name: lm75_bench_log_aggregate.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of range aggregates over one year of one sensor at 1 Hz and 0.1 Hz:
+ *              LM75_Log_Aggregate with the block summaries against decoding from the start of the log.
+ *              The scanned ranges also check the query results.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_bench_log_aggregate.c LM75/Src/lm75_log.c -lm
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+#include "lm75_log.h"
+
+
+/* Timestamps in seconds, so one year does not wrap */
+#define YEAR_S              (365UL * 86400UL)
+#define PI                  3.14159265358979
+
+/* Ranges queried per length, and ranges also answered by a scan */
+#define QUERIES             1000
+#define SCANS               5
+
+
+/* Log written by the sink */
+typedef struct {
+    uint8_t *data;
+    size_t len;
+    size_t size;
+} Buffer;
+
+
+static const struct {
+    const char *name;
+    uint32_t length_s;
+} ranges[] = {
+    { "1 hour", 3600 },
+    { "1 day", 86400 },
+    { "1 month", 30 * 86400 },
+    { "whole log", YEAR_S }
+};
+
+
+static uint32_t seed = 12345;
+
+
+static uint32_t next_random(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return seed;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static LM75_Status write_buffer(void *ctx, const uint8_t *data, uint32_t len)
+{
+    Buffer *buf = (Buffer *)ctx;
+
+    if (buf->size - buf->len < len)
+    {
+        return LM75_ERROR;
+    }
+
+    memcpy(&buf->data[buf->len], data, len);
+    buf->len += len;
+
+    return LM75_OK;
+}
+
+/* Seasonal and daily cycles, +-0.25 degree noise and a rare 20 degree spike, read by an 11-bit sensor */
+static int write_year(Buffer *buf, uint32_t period_s)
+{
+    LM75_LogWriter writer;
+
+    seed = 12345;
+    buf->len = 0;
+    LM75_Log_WriterInit(&writer, LM75_11BIT, write_buffer, buf);
+
+    for (uint32_t t = 0; t < YEAR_S; t += period_s)
+    {
+        uint32_t r = next_random();
+        double temp = 15.0 + 10.0 * sin(2.0 * PI * t / YEAR_S) + 5.0 * sin(2.0 * PI * t / 86400.0) +
+                      0.5 * ((double)(r & 0xFFFF) / 65535.0 - 0.5);
+
+        if (0 == (r >> 16) % 100000)
+        {
+            temp += 20.0;
+        }
+
+        if (LM75_OK != LM75_Log_Append(&writer, t, (uint16_t)((int16_t)(temp * 256.0) & 0xFFE0)))
+        {
+            return 1;
+        }
+    }
+
+    return (LM75_OK != LM75_Log_Flush(&writer));
+}
+
+/* Aggregate by decoding every sample from the start of the log up to the end of the range */
+static void scan(const Buffer *buf, uint32_t from, uint32_t to, LM75_LogAggregate *result)
+{
+    LM75_LogReader reader;
+    uint32_t ts = 0;
+    uint16_t raw = 0;
+
+    memset(result, 0, sizeof(*result));
+    result->min = INT16_MAX;
+    result->max = INT16_MIN;
+    LM75_Log_ReaderInit(&reader, buf->data, buf->len);
+
+    while (LM75_Log_Next(&reader, &ts, &raw) && ts <= to)
+    {
+        if (ts >= from)
+        {
+            result->count++;
+            result->sum += (int16_t)raw;
+            result->min = ((int16_t)raw < result->min) ? (int16_t)raw : result->min;
+            result->max = ((int16_t)raw > result->max) ? (int16_t)raw : result->max;
+        }
+    }
+}
+
+/* Time the queries of every range length, returns the number of results differing from the scan */
+static unsigned long run(Buffer *buf, uint32_t period_s)
+{
+    LM75_LogIndexEntry *entries = NULL;
+    LM75_LogReader reader;
+    uint32_t count = 0;
+    unsigned long bad = 0;
+
+    if (0 != write_year(buf, period_s))
+    {
+        printf("log write failed\n");
+        return 1;
+    }
+
+    LM75_Log_BuildIndex(buf->data, buf->len, NULL, 0, &count);
+    entries = malloc(sizeof(LM75_LogIndexEntry) * count);
+
+    if (NULL == entries || LM75_OK != LM75_Log_BuildIndex(buf->data, buf->len, entries, count, &count))
+    {
+        printf("index failed\n");
+        return 1;
+    }
+
+    LM75_Log_ReaderInit(&reader, buf->data, buf->len);
+
+    printf("One year, one sample every %lu s: %lu samples, %.1f MB in %lu blocks\n",
+           (unsigned long)period_s, YEAR_S / period_s, (double)buf->len * 1e-6, (unsigned long)count);
+
+    for (size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++)
+    {
+        uint32_t span = YEAR_S - ranges[r].length_s;
+        unsigned long decoded = 0;
+        double query_s = 0.0;
+        double scan_s = 0.0;
+        double start = 0.0;
+
+        for (unsigned q = 0; q < QUERIES; q++)
+        {
+            uint32_t from = (0 == span) ? 0 : next_random() % span;
+            uint32_t to = from + ranges[r].length_s - 1;
+            LM75_LogAggregate agg;
+            LM75_LogAggregate ref;
+
+            start = now_s();
+            bad += (LM75_OK != LM75_Log_Aggregate(&reader, entries, count, from, to, &agg));
+            query_s += now_s() - start;
+            decoded += agg.decoded;
+
+            if (q < SCANS)
+            {
+                start = now_s();
+                scan(buf, from, to, &ref);
+                scan_s += now_s() - start;
+
+                bad += (agg.count != ref.count || agg.sum != ref.sum ||
+                        (0 != ref.count && (agg.min != ref.min || agg.max != ref.max)));
+            }
+        }
+
+        printf("  %-9s  query %8.1f us (%.1f blocks decoded)  vs  scan from the start %8.1f ms\n",
+               ranges[r].name, query_s * 1e6 / QUERIES, (double)decoded / QUERIES, scan_s * 1e3 / SCANS);
+    }
+
+    free(entries);
+
+    return bad;
+}
+
+int main(void)
+{
+    Buffer buf = { NULL, 0, 64UL * 1024UL * 1024UL };
+    unsigned long bad = 0;
+
+    buf.data = malloc(buf.size);
+
+    if (NULL == buf.data)
+    {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    bad += run(&buf, 1);
+    bad += run(&buf, 10);
+
+    printf("%lu result(s) differing from the scan\n", bad);
+
+    free(buf.data);
+
+    return (0 != bad);
+}
@@ -0,0 +1,218 @@
+/*******************************************************
+ * File Name: lm75_bench_log_index.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of opening a large log dump: map and index against reading the file onto the heap,
+ *              reopening with a saved index, and random seeks. Writes the dump and its index to the given
+ *              path (default /tmp/lm75_bench.l7 and .ix). Build again with -DLM75_LOG_BLOCK_SAMPLES=8192
+ *              to compare block sizes.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -DLM75_LOG_MMAP -ILM75/Inc LM75/Bench/lm75_bench_log_index.c LM75/Src/lm75_log.c
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+#include "lm75_log.h"
+
+
+/* One sample per second, the timestamp of a sample is its number */
+#define SAMPLES             300000000ULL
+#define SEEKS               100000UL
+
+
+static uint32_t seed = 12345;
+
+
+static uint32_t next_random(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return seed;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static LM75_Status write_file(void *ctx, const uint8_t *data, uint32_t len)
+{
+    return (len == fwrite(data, 1, len, (FILE *)ctx)) ? LM75_OK : LM75_ERROR;
+}
+
+/* Slow random walk of an 11-bit sensor, fixed seed */
+static int write_log(const char *path)
+{
+    LM75_LogWriter writer;
+    FILE *file = fopen(path, "wb");
+    int32_t value = 25 * 256;
+    int failed = (NULL == file);
+
+    if (failed)
+    {
+        return 1;
+    }
+
+    LM75_Log_WriterInit(&writer, LM75_11BIT, write_file, file);
+
+    for (uint64_t i = 0; i < SAMPLES && !failed; i++)
+    {
+        uint32_t r = next_random();
+
+        if (0 == r % 16)
+        {
+            value += (0 != (r & 0x10)) ? 32 : -32;
+            value = (value < -40 * 256) ? -40 * 256 : (value > 100 * 256) ? 100 * 256 : value;
+        }
+
+        failed = (LM75_OK != LM75_Log_Append(&writer, (uint32_t)i, (uint16_t)(int16_t)value));
+    }
+
+    failed |= (LM75_OK != LM75_Log_Flush(&writer));
+    failed |= (0 != fclose(file));
+
+    return failed;
+}
+
+/* Read the whole file onto the heap, the baseline of mapping it */
+static double read_heap(const char *path, size_t size)
+{
+    double start = now_s();
+    FILE *file = fopen(path, "rb");
+    uint8_t *data = malloc(size);
+    size_t got = 0;
+
+    if (NULL != file && NULL != data)
+    {
+        got = fread(data, 1, size, file);
+    }
+
+    if (NULL != file)
+    {
+        fclose(file);
+    }
+
+    free(data);
+
+    return (got == size) ? now_s() - start : -1.0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "/tmp/lm75_bench.l7";
+    char index_path[256];
+    const uint8_t *data = NULL;
+    const uint8_t *index_data = NULL;
+    const LM75_LogIndexEntry *loaded = NULL;
+    LM75_LogIndexEntry *entries = NULL;
+    LM75_LogReader reader;
+    FILE *file = NULL;
+    size_t size = 0;
+    size_t index_size = 0;
+    uint32_t count = 0;
+    uint32_t ts = 0;
+    uint16_t raw = 0;
+    unsigned long bad = 0;
+    double heap_s = 0.0;
+    double open_s = 0.0;
+    double reopen_s = 0.0;
+    double seek_s = 0.0;
+    double start = 0.0;
+
+    snprintf(index_path, sizeof(index_path), "%s.ix", path);
+
+    if (0 != write_log(path) || LM75_OK != LM75_Log_MapFile(path, &data, &size))
+    {
+        printf("cannot write %s\n", path);
+        return 1;
+    }
+
+    LM75_Log_UnmapFile(data, size);
+    heap_s = read_heap(path, size);
+
+    /* Map and index: one pass over the block headers to count, one to fill */
+    start = now_s();
+    LM75_Log_MapFile(path, &data, &size);
+    LM75_Log_BuildIndex(data, size, NULL, 0, &count);
+    entries = malloc(sizeof(LM75_LogIndexEntry) * count);
+
+    if (NULL == entries || LM75_OK != LM75_Log_BuildIndex(data, size, entries, count, &count))
+    {
+        printf("index failed\n");
+        return 1;
+    }
+
+    open_s = now_s() - start;
+
+    file = fopen(index_path, "wb");
+
+    if (NULL == file || LM75_OK != LM75_Log_SaveIndex(entries, count, size, write_file, file) || 0 != fclose(file))
+    {
+        printf("cannot write %s\n", index_path);
+        return 1;
+    }
+
+    free(entries);
+    LM75_Log_UnmapFile(data, size);
+
+    /* Reopen with the saved index and read the last sample */
+    start = now_s();
+    LM75_Log_MapFile(path, &data, &size);
+    LM75_Log_MapFile(index_path, &index_data, &index_size);
+
+    if (LM75_OK != LM75_Log_LoadIndex(index_data, index_size, size, &loaded, &count))
+    {
+        printf("index load failed\n");
+        return 1;
+    }
+
+    LM75_Log_ReaderInit(&reader, data, size);
+    bad += (LM75_OK != LM75_Log_SeekSample(&reader, loaded, count, SAMPLES - 1));
+    bad += !LM75_Log_Next(&reader, &ts, &raw) || (SAMPLES - 1 != ts);
+    reopen_s = now_s() - start;
+
+    /* Random seeks, each followed by the read of the sample */
+    start = now_s();
+
+    for (unsigned long i = 0; i < SEEKS; i++)
+    {
+        uint64_t sample = (((uint64_t)next_random() << 32) | next_random()) % SAMPLES;
+
+        bad += (LM75_OK != LM75_Log_SeekSample(&reader, loaded, count, sample));
+        bad += !LM75_Log_Next(&reader, &ts, &raw) || (sample != ts);
+    }
+
+    seek_s = now_s() - start;
+
+    printf("%llu samples, %u-sample blocks: %.0f MB in %lu blocks, index %.1f MB\n",
+           (unsigned long long)SAMPLES, LM75_LOG_BLOCK_SAMPLES, (double)size * 1e-6, (unsigned long)count, (double)index_size * 1e-6);
+    printf("  read onto the heap      %8.1f ms\n", heap_s * 1e3);
+    printf("  map + build index       %8.1f ms\n", open_s * 1e3);
+    printf("  map + saved index, seek %8.3f ms to the last sample\n", reopen_s * 1e3);
+    printf("  random seek + read      %8.2f us\n", seek_s * 1e6 / SEEKS);
+    printf("  %lu wrong seek(s)\n", bad);
+
+    LM75_Log_UnmapFile(index_data, index_size);
+    LM75_Log_UnmapFile(data, size);
+    remove(index_path);
+    remove(path);
+
+    return (0 != bad);
+}
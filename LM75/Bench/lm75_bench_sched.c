@@ -0,0 +1,97 @@
+/*******************************************************
+ * File Name: lm75_bench_sched.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of the wake-ups saved by the wake scheduler, on simulated sensors.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_bench_sched.c LM75/Src/lm75_sched.c
+ *            LM75/Src/lm75_health.c LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c -lpthread
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <stdio.h>
+
+
+#include "lm75_sched.h"
+#include "lm75_sim.h"
+
+
+#define SENSORS             3
+
+/* One hour of LM75_TIMESTAMP() milliseconds */
+#define HORIZON_MS          3600000UL
+
+
+/* Read period and tolerance of each sensor in milliseconds */
+static const uint32_t periods[SENSORS] = { 60000, 65000, 90000 };
+static const uint32_t tolerances[SENSORS] = { 10000, 15000, 20000 };
+
+
+int main(void)
+{
+    LM75_SimDevice sdevs[SENSORS];
+    struct LM75_SimBus bus;
+    LM75 devs[SENSORS];
+    LM75_Cold colds[SENSORS];
+    LM75_SchedEntry entries[SENSORS];
+    LM75_Sched sch;
+    uint32_t planned_wakeups = 0;
+    uint32_t planned_reads = 0;
+    uint32_t start = 0;
+    uint32_t awake_us = 0;
+    uint32_t errors = 0;
+
+    for (uint8_t i = 0; i < SENSORS; i++)
+    {
+        LM75_Sim_InitDevice(&sdevs[i], (uint8_t)(0x48 + i), 22.0f, 0.5f, 2000, i + 1U);
+    }
+
+    LM75_Sim_InitBus(&bus, sdevs, SENSORS, 100000);
+
+    for (uint8_t i = 0; i < SENSORS; i++)
+    {
+        if (LM75_OK != LM75_Init(&devs[i], &colds[i], &bus, NULL, LM75_11BIT, (uint8_t)(0x48 + i), 40.0f, 60.0f))
+        {
+            printf("init failed\n");
+            return 1;
+        }
+
+        entries[i].dev = &devs[i];
+        entries[i].period = periods[i];
+        entries[i].tolerance = tolerances[i];
+        entries[i].health = NULL;
+    }
+
+    if (LM75_OK != LM75_Sched_Init(&sch, entries, SENSORS, LM75_TIMESTAMP()) ||
+        LM75_OK != LM75_Sched_Plan(&sch, HORIZON_MS, &planned_wakeups, &planned_reads))
+    {
+        printf("scheduler init failed\n");
+        return 1;
+    }
+
+    /* Sleep on the bus clock until the next wake-up, then read every sensor whose window is open; the horizon starts at the first wake-up like the plan */
+    start = LM75_Sched_NextWake(&sch);
+
+    while (LM75_Sched_NextWake(&sch) - start < HORIZON_MS)
+    {
+        uint32_t before_us = 0;
+        uint32_t wake = LM75_Sched_NextWake(&sch);
+
+        LM75_Sim_Idle(&bus, (wake - LM75_TIMESTAMP()) * 1000U);
+
+        before_us = bus.now_us;
+        errors += (LM75_OK != LM75_Sched_Run(&sch, LM75_TIMESTAMP())) ? 1U : 0U;
+        awake_us += bus.now_us - before_us;
+    }
+
+    printf("%u sensors over one hour of bus time:\n", SENSORS);
+    printf("  planned: %lu wake-ups for %lu reads\n", (unsigned long)planned_wakeups, (unsigned long)planned_reads);
+    printf("  run:     %lu wake-ups for %lu reads, %lu us on the bus, %lu failed wake-up(s)\n",
+           (unsigned long)sch.wakeups, (unsigned long)sch.reads, (unsigned long)awake_us, (unsigned long)errors);
+    printf("  without coalescing: %lu wake-ups\n", (unsigned long)sch.reads);
+
+    return 0;
+}
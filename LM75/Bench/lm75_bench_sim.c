@@ -0,0 +1,106 @@
+/*******************************************************
+ * File Name: lm75_bench_sim.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host benchmark of LM75_Sim_Run throughput against the number of worker threads.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_bench_sim.c
+ *            LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c -lpthread
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#define _POSIX_C_SOURCE     200809L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+
+#include "lm75_sim.h"
+
+
+/* 4096 sensors, 8 per bus, each read ROUNDS times per run */
+#define BUSES               512
+#define PER_BUS             8
+#define ROUNDS              2000
+
+
+static const uint8_t sweep[] = { 1, 2, 4, 8, 16, 32 };
+
+
+int main(void)
+{
+    LM75_SimDevice *sdevs = malloc(sizeof(LM75_SimDevice) * BUSES * PER_BUS);
+    LM75_Bus *buses = malloc(sizeof(LM75_Bus) * BUSES);
+    LM75 *sensors = malloc(sizeof(LM75) * BUSES * PER_BUS);
+    LM75_Cold *colds = malloc(sizeof(LM75_Cold) * BUSES * PER_BUS);
+    LM75_SimJob jobs[BUSES];
+    LM75_SimReport report;
+    double base = 0.0;
+
+    if (NULL == sdevs || NULL == buses || NULL == sensors || NULL == colds)
+    {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    for (uint32_t b = 0; b < BUSES; b++)
+    {
+        for (uint32_t i = 0; i < PER_BUS; i++)
+        {
+            uint32_t n = b * PER_BUS + i;
+
+            LM75_Sim_InitDevice(&sdevs[n], (uint8_t)(0x48 + i), 20.0f + (float)(n % 16), 0.5f, 2000, n + 1U);
+        }
+
+        LM75_Sim_InitBus(&buses[b], &sdevs[b * PER_BUS], PER_BUS, 400000);
+
+        for (uint32_t i = 0; i < PER_BUS; i++)
+        {
+            uint32_t n = b * PER_BUS + i;
+
+            if (LM75_OK != LM75_Init(&sensors[n], &colds[n], &buses[b], NULL, LM75_11BIT, (uint8_t)(0x48 + i), 40.0f, 60.0f))
+            {
+                printf("init failed\n");
+                return 1;
+            }
+        }
+
+        jobs[b].bus = &buses[b];
+        jobs[b].sensors = &sensors[b * PER_BUS];
+        jobs[b].count = PER_BUS;
+        jobs[b].rounds = ROUNDS;
+    }
+
+    printf("%u sensors on %u buses, %u rounds, %ld online CPU(s):\n",
+           BUSES * PER_BUS, BUSES, ROUNDS, sysconf(_SC_NPROCESSORS_ONLN));
+
+    for (uint8_t s = 0; s < sizeof(sweep); s++)
+    {
+        if (LM75_OK != LM75_Sim_Run(jobs, BUSES, sweep[s], &report))
+        {
+            printf("run failed\n");
+            return 1;
+        }
+
+        if (0 == s)
+        {
+            base = (double)report.reads_per_s;
+        }
+
+        printf("  %2u thread(s): %8.1f ms, %6.2f M reads/s, x%.2f, %llu errors, %u jobs stolen\n",
+               sweep[s], (double)report.elapsed_us * 1e-3, (double)report.reads_per_s * 1e-6,
+               (double)report.reads_per_s / base, (unsigned long long)report.errors, (unsigned)report.stolen);
+    }
+
+    free(colds);
+    free(sensors);
+    free(buses);
+    free(sdevs);
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*******************************************************
+ * File Name: lm75_check_coro.cpp
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host check of the coroutine layer: thousands of coroutines awaiting reads of simulated sensors
+ *              must get the right values, without heap allocation, and give back their frames.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc -c LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c
+ *        g++ -O2 -std=c++20 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_check_coro.cpp lm75.o lm75_sim.o lm75_os.o lm75_energy.o -lpthread
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+
+/* Seven sensors per bus, 0x4F stays absent */
+#define BUSES               512
+#define PER_BUS             7
+#define SENSORS             (BUSES * PER_BUS)
+#define READS               5
+
+/* One frame per sensor coroutine, one for the absent sensor and one sweep */
+#define LM75_CORO_FRAMES    (SENSORS + 2)
+
+
+#include "lm75_coro.h"
+#include "lm75_sim.h"
+
+
+/* Heap allocations made by the program, none may happen while coroutines run */
+static unsigned long allocations = 0;
+
+void *operator new(std::size_t size)
+{
+    void *p = std::malloc(size ? size : 1);
+
+    allocations++;
+
+    if (nullptr == p)
+    {
+        std::abort();
+    }
+
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+
+static LM75_SimDevice sdevs[SENSORS];
+static LM75_Bus buses[BUSES];
+static LM75 devs[SENSORS];
+static LM75_Cold colds[SENSORS];
+
+/* Expected Temp register value of each sensor, the simulated sensors have no noise */
+static uint16_t expected[SENSORS];
+
+/* Reads that returned LM75_OK with the expected value, and all other outcomes */
+static unsigned long good = 0;
+static unsigned long bad = 0;
+
+
+/* Read one sensor READS times, letting one conversion pass between reads */
+static LM75_Task poll(LM75_Sensor &sensor, unsigned index)
+{
+    for (int i = 0; i < READS; i++)
+    {
+        LM75_Status status = co_await sensor.read();
+
+        if (LM75_OK == status && expected[index] == sensor.dev().temp_raw)
+        {
+            good++;
+        }
+        else
+        {
+            bad++;
+        }
+
+        LM75_Sim_Idle(sensor.dev().i2c, 100000);
+    }
+}
+
+/* Read every sensor in turn from one coroutine */
+static LM75_Task sweep(LM75_Sensor *sensors)
+{
+    for (unsigned i = 0; i < SENSORS; i++)
+    {
+        LM75_Status status = co_await sensors[i].read();
+
+        if (LM75_OK == status && expected[i] == sensors[i].dev().temp_raw)
+        {
+            good++;
+        }
+        else
+        {
+            bad++;
+        }
+    }
+}
+
+/* A read of a sensor absent from the bus must resume with LM75_ERROR */
+static LM75_Task absent(LM75_Sensor &sensor, bool *failed)
+{
+    *failed = (LM75_ERROR == co_await sensor.read());
+}
+
+/* The run queues hold one handle per frame, too large for the stack */
+static LM75_Executor exec;
+
+
+int main()
+{
+    LM75_Sensor *sensors = static_cast<LM75_Sensor *>(std::malloc(sizeof(LM75_Sensor) * SENSORS));
+    LM75 missing_dev;
+    LM75_Cold missing_cold;
+    bool missing_failed = false;
+    unsigned long before = 0;
+    int failed = 0;
+
+    for (unsigned i = 0; i < SENSORS; i++)
+    {
+        float ambient = 20.0f + 0.5f * static_cast<float>(i % 100);
+
+        LM75_Sim_InitDevice(&sdevs[i], static_cast<uint8_t>(0x48 + i % PER_BUS), ambient, 0.0f, 1000, i + 1U);
+        sdevs[i].noise = 0;
+        expected[i] = static_cast<uint16_t>(static_cast<int16_t>(ambient * 256.0f)) & 0xFFE0;
+    }
+
+    for (unsigned b = 0; b < BUSES; b++)
+    {
+        LM75_Sim_InitBus(&buses[b], &sdevs[b * PER_BUS], PER_BUS, 400000);
+    }
+
+    for (unsigned i = 0; i < SENSORS; i++)
+    {
+        if (LM75_OK != LM75_Init(&devs[i], &colds[i], &buses[i / PER_BUS], nullptr, LM75_11BIT, static_cast<uint8_t>(0x48 + i % PER_BUS), 40.0f, 60.0f))
+        {
+            std::printf("init failed\n");
+            return 1;
+        }
+
+        new (&sensors[i]) LM75_Sensor(devs[i], exec);
+    }
+
+    LM75_Init(&missing_dev, &missing_cold, &buses[0], nullptr, LM75_11BIT, 0x4F, 40.0f, 60.0f);
+    LM75_Sensor missing(missing_dev, exec);
+
+    before = allocations;
+
+    /* One coroutine per sensor, more tasks than frames must be refused */
+    for (unsigned i = 0; i < SENSORS; i++)
+    {
+        failed |= !exec.spawn(poll(sensors[i], i));
+    }
+
+    failed |= !exec.spawn(absent(missing, &missing_failed));
+    failed |= !exec.spawn(sweep(sensors));
+    failed |= exec.spawn(sweep(sensors));
+    failed |= (0 != exec.run());
+
+    /* Frames are reused once the first tasks are done */
+    failed |= !exec.spawn(sweep(sensors));
+    failed |= (0 != exec.run());
+
+    failed |= (allocations != before);
+    failed |= !missing_failed;
+    failed |= (0 != LM75_FramePool::in_use());
+    failed |= (0 != bad) || (SENSORS * READS + 2 * SENSORS != good);
+
+    std::printf("%u frames: %lu good reads, %lu bad, %lu heap allocation(s) while running, %zu frame(s) in use\n",
+                LM75_CORO_FRAMES, good, bad, allocations - before, LM75_FramePool::in_use());
+    std::printf("%s\n", failed ? "FAILED" : "passed");
+
+    std::free(sensors);
+
+    return failed;
+}
@@ -0,0 +1,63 @@
+/*******************************************************
+ * File Name: lm75_check_health.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host check of the stuck sensor detection after rising and falling ramps.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_check_health.c LM75/Src/lm75_health.c
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <stdio.h>
+
+
+#include "lm75_health.h"
+
+
+#define STUCK_READS         100
+#define HELD_READS          5000
+
+
+/* Ramp the raw value by step for count reads, then hold it, returns the final state */
+static LM75_HealthState ramp_then_hold(int16_t start, int16_t step, uint16_t count)
+{
+    LM75_Health health;
+    int16_t value = start;
+    uint32_t now = 0;
+
+    LM75_Health_Init(&health, 4, 0x8000, STUCK_READS, 10000, now);
+
+    for (uint16_t i = 0; i < count; i++, now++)
+    {
+        LM75_Health_Update(&health, LM75_OK, (uint16_t)value, now);
+        value = (int16_t)(value + step);
+    }
+
+    for (uint16_t i = 0; i < HELD_READS; i++, now++)
+    {
+        LM75_Health_Update(&health, LM75_OK, (uint16_t)value, now);
+    }
+
+    printf("start %6d step %4d: mean %ld var %lu same %u state %d\n",
+           start, step, (long)health.mean, (unsigned long)health.var, health.same, (int)health.state);
+
+    return (LM75_HealthState)health.state;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    /* 11-bit steps are 32 raw units, rising and falling ramps must both end stuck */
+    failed |= (LM75_HEALTH_STUCK != ramp_then_hold(20 * 256, 32, 200));
+    failed |= (LM75_HEALTH_STUCK != ramp_then_hold(40 * 256, -32, 200));
+    failed |= (LM75_HEALTH_STUCK != ramp_then_hold(-10 * 256, 128, 50));
+    failed |= (LM75_HEALTH_STUCK != ramp_then_hold(0, 1, 1000));
+
+    printf("%s\n", failed ? "FAILED" : "passed");
+
+    return failed;
+}
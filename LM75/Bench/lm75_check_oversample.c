@@ -0,0 +1,114 @@
+/*******************************************************
+ * File Name: lm75_check_oversample.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Host check of the oversampling mode on the simulated bus: a 9-bit part at 25.3 degrees,
+ *              256 reads with +-0.06 and +-0.5 degree conversion noise, and the spacing of the reads
+ *              after a late poll.
+ *
+ * Build: gcc -O2 -std=c99 -DLM75_USE_SIM -ILM75/Inc LM75/Bench/lm75_check_oversample.c LM75/Src/lm75_oversample.c
+ *            LM75/Src/lm75.c LM75/Src/lm75_sim.c LM75/Src/lm75_os.c LM75/Src/lm75_energy.c
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <stdio.h>
+
+
+#include "lm75_oversample.h"
+#include "lm75_sim.h"
+
+
+#define READS               256
+#define AMBIENT_C           25.3f
+#define SEED                12345
+
+
+static LM75_SimDevice sim;
+static LM75_Bus bus;
+static LM75 sensor;
+static LM75_Cold sensor_cold;
+
+
+/* Power up the sensor with the given noise amplitude in 1/256 degree celsius */
+static int power_up(uint32_t noise)
+{
+    LM75_Sim_InitDevice(&sim, 0x48, AMBIENT_C, 0.0f, 1000, SEED);
+    sim.noise = noise;
+    LM75_Sim_InitBus(&bus, &sim, 1, 400000);
+
+    return (LM75_OK != LM75_Init(&sensor, &sensor_cold, &bus, NULL, LM75_9BIT, 0x48, 40.0f, 60.0f));
+}
+
+/* Oversample READS reads, the poll loop lets 1 ms of bus time pass between polls. Values in 1/256 degree celsius */
+static int oversample(uint32_t noise, int16_t expected, int16_t tolerance)
+{
+    LM75_Oversample os;
+    int16_t result = 0;
+    uint16_t good = 0;
+
+    if (0 != power_up(noise) ||
+        LM75_OK != LM75_Oversample_Start(&os, &sensor, READS, LM75_OVERSAMPLE_INTERVAL, LM75_TIMESTAMP()))
+    {
+        return 1;
+    }
+
+    while (!LM75_Oversample_Poll(&os, LM75_TIMESTAMP()))
+    {
+        LM75_Sim_Idle(&bus, 1000);
+    }
+
+    if (LM75_OK != LM75_Oversample_Result(&os, &result, &good) || LM75_OK != LM75_GetTemperature(&sensor))
+    {
+        return 1;
+    }
+
+    printf("noise +-%.2f C: %u good reads, oversampled %.2f C, plain read %.2f C\n",
+           noise / 256.0, good, result / 256.0, sensor.temp_c);
+
+    return (READS != good || result < expected - tolerance || result > expected + tolerance);
+}
+
+/* A poll several intervals late makes one read, the next one is a full interval after it */
+static int late_poll(void)
+{
+    LM75_Oversample os;
+    uint16_t started = 0;
+
+    if (0 != power_up(16) ||
+        LM75_OK != LM75_Oversample_Start(&os, &sensor, 8, LM75_OVERSAMPLE_INTERVAL, LM75_TIMESTAMP()))
+    {
+        return 1;
+    }
+
+    (void)LM75_Oversample_Poll(&os, LM75_TIMESTAMP());
+    LM75_Sim_Idle(&bus, 10U * LM75_OVERSAMPLE_INTERVAL * 1000U);
+    (void)LM75_Oversample_Poll(&os, LM75_TIMESTAMP());
+    started = os.started;
+    LM75_Sim_Idle(&bus, 1000);
+    (void)LM75_Oversample_Poll(&os, LM75_TIMESTAMP());
+
+    printf("late poll: %u reads started after it, %u one ms later\n", started, os.started);
+
+    return (2 != started || 2 != os.started);
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    /*
+     * Plain 9-bit reads give 25.0. Small noise hardly crosses a step, the result is the step plus the
+     * half-step correction, 25.25. Large noise spreads the readings over the neighbouring steps and the
+     * mean moves towards 25.3: 25.27 to 25.36 depending on the seed, hence the 0.05 degree tolerance.
+     */
+    failed |= oversample(16, (int16_t)(25.25f * 256.0f), 0);
+    failed |= oversample(128, (int16_t)(25.3f * 256.0f), (int16_t)(0.05f * 256.0f));
+    failed |= late_poll();
+
+    printf("%s\n", failed ? "FAILED" : "passed");
+
+    return failed;
+}
@@ -13,9 +13,58 @@
 #define __LM75__
 
 
+#include <stdbool.h>
+#include <stddef.h>
+
+
+#include "lm75_os.h"
+#include "lm75_regs.h"
+
+
+/* Define LM75_USE_SIM to run the driver on a host against simulated sensors, see lm75_sim.h */
+#ifndef LM75_USE_SIM
+
 /* Replace this line with your version of HAL */
 #include "stm32f0xx_hal.h"
 
+#endif
+
+
+/* Define LM75_USE_LL to drive the I2C peripheral registers through the LL driver instead of HAL */
+#ifdef LM75_USE_LL
+#include "stm32f0xx_ll_i2c.h"
+#endif
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Timestamp source of the driver extensions, define before including to use a finer clock */
+#ifndef LM75_TIMESTAMP
+#ifdef LM75_USE_SIM
+#define LM75_TIMESTAMP()        LM75_Sim_Now()
+#else
+#define LM75_TIMESTAMP()        HAL_GetTick()
+#endif
+#endif
+
+
+/* Compose a Conf register value from its fields, usable in constant expressions */
+#define LM75_CONF_ENCODE(faults, polarity, mode, shutdown) \
+    ( (uint8_t)( (faults) | (polarity) | (mode) | ((shutdown) ? LM75_CONF_SHUTDOWN : 0x00) ) )
+
+/* Raw Tos or Thyst register value of a temperature, truncated to 0.5 degree steps, usable in static initialisers */
+#define LM75_LIMIT_ENCODE(temp_c)       ( (uint16_t)( (uint16_t)(int16_t)((temp_c) * 2.0f) * 128U ) )
+
+/* Bytes of a raw register value in transmission order */
+#define LM75_RAW_MSB(raw)               ( (uint8_t)((raw) >> 8) )
+#define LM75_RAW_LSB(raw)               ( (uint8_t)((raw) & 0xFF) )
+
+/* Check that a Conf register value does not touch the reserved bits */
+#define LM75_CONF_IS_VALID(reg_val)     ( 0 == ((reg_val) & ~LM75_CONF_MASK) )
+
 
 /* Status returned by LM75 functions*/
 typedef enum {
@@ -24,42 +73,198 @@ typedef enum {
 } LM75_Status;
 
 
-/* LM75 sensor version depending on how the Temp register is read */
+/* Number of consecutive faults needed to change the O.S. output */
 typedef enum {
-    LM75_9BIT,
-    LM75_11BIT
-} LM75_Version;
+    LM75_FAULTS_1 = LM75_CONF_PUT(FAULTS, 0),
+    LM75_FAULTS_2 = LM75_CONF_PUT(FAULTS, 1),
+    LM75_FAULTS_4 = LM75_CONF_PUT(FAULTS, 2),
+    LM75_FAULTS_6 = LM75_CONF_PUT(FAULTS, 3)
+} LM75_FaultQueue;
 
 
-/* Structure storing the sensor properties */
+/* O.S. output polarity */
+typedef enum {
+    LM75_OS_ACT_LOW = LM75_CONF_PUT(POL, 0),
+    LM75_OS_ACT_HIGH = LM75_CONF_PUT(POL, 1)
+} LM75_OsPolarity;
+
+
+/* O.S. output operation mode */
+typedef enum {
+    LM75_CMP_MODE = LM75_CONF_PUT(MODE, 0),
+    LM75_INT_MODE = LM75_CONF_PUT(MODE, 1)
+} LM75_OsMode;
+
+
+/* Decoded content of the Conf register */
 typedef struct {
-    /* I2C interface to which the sensor is connected */
-    I2C_HandleTypeDef *i2c;
+    /* Fault queue length */
+    LM75_FaultQueue faults;
 
-    /* Sensor version */
-    LM75_Version ver;
+    /* O.S. output polarity */
+    LM75_OsPolarity polarity;
 
-    /* Sensor address */
-    uint8_t addr;
+    /* Comparator or interrupt mode */
+    LM75_OsMode mode;
+
+    /* Shutdown mode enabled */
+    bool shutdown;
+} LM75_Config;
+
+
+/* Pointer register value when the selected register is not known */
+#define LM75_PTR_UNKNOWN        0xFF
+
+
+/* Bus type the sensor is connected to */
+#if defined(LM75_USE_SIM)
+typedef struct LM75_SimBus LM75_Bus;
+uint32_t LM75_Sim_Now(void);
+#elif defined(LM75_USE_LL)
+typedef I2C_TypeDef LM75_Bus;
+#else
+typedef I2C_HandleTypeDef LM75_Bus;
+#endif
+
+
+/* State of the interrupt driven transfer */
+typedef enum {
+    LM75_XFER_IDLE,
+    LM75_XFER_PTR,
+    LM75_XFER_DATA,
+    LM75_XFER_DONE,
+    LM75_XFER_ERROR
+} LM75_XferState;
 
+
+typedef struct LM75 LM75;
+
+
+/* Optional energy accounting, see lm75_energy.h */
+typedef struct LM75_Energy LM75_Energy;
+
+
+/* Called from interrupt context when an interrupt driven read ends */
+typedef void (*LM75_Callback)(LM75 *dev, LM75_Status status, void *ctx);
+
+
+/* Working state of an interrupt driven read, only touched while one runs */
+typedef struct {
+    /* Register pointed by the read */
+    uint8_t reg;
+
+    /* Number of bytes to receive and already received */
+    uint8_t len;
+    uint8_t idx;
+
+    /* Receive buffer */
+    uint8_t buf[LM75_REG_MAX_SIZE];
+
+#ifdef LM75_FAULT_INJECTION
+    /* Injected fault flipping one received bit */
+    bool corrupt;
+#endif
+
+    /* Completion callback and its argument */
+    LM75_Callback cb;
+    void *cb_ctx;
+} LM75_XferCtx;
+
+
+/* Sensor properties not needed to decode a reading, stored apart from the LM75 descriptor */
+typedef struct {
     /* Actual temperature in degrees celsius stored in the Thyst register */
     float thyst_c;
 
     /* Actual temperature in degrees celsius stored in the Tos register */
     float tos_c;
 
+    /* Last values written to or read from the writable registers */
+    LM75_Shadow shadow;
+
+    /* Interrupt driven read in progress, its state is LM75.xfer */
+    LM75_XferCtx it;
+
+    /* Lock shared by the sensors of the same bus, NULL if not used */
+    LM75_BusLock *lock;
+
+    /* Energy accounting attached with LM75_Energy_Attach, NULL if not used */
+    LM75_Energy *energy;
+} LM75_Cold;
+
+
+/* Structure storing the sensor properties used on every read, kept small for scans over many sensors */
+struct LM75 {
+    /* I2C interface to which the sensor is connected */
+    LM75_Bus *i2c;
+
+    /* Configuration data of the sensor */
+    LM75_Cold *cold;
+
     /* Actual temperature in degrees celsius stored in the Temp register */
     float temp_c;
-} LM75;
 
+    /* Raw value of the Temp register of the last successful read */
+    uint16_t temp_raw;
+
+    /* Sensor address */
+    uint8_t addr;
 
-LM75_Status LM75_Init(LM75 *dev, I2C_HandleTypeDef *hi2c, LM75_Version ver, uint8_t addr, float low_lim, float upp_lim);
+    /* Sensor version, LM75_Version */
+    uint8_t ver;
+
+    /* Register selected by the pointer register of the sensor, LM75_PTR_UNKNOWN if not known */
+    uint8_t ptr;
+
+    /* State of the interrupt driven read, LM75_XferState, its working data is in cold->it */
+    volatile uint8_t xfer;
+};
+
+
+LM75_Status LM75_Init(LM75 *dev, LM75_Cold *cold, LM75_Bus *hi2c, LM75_BusLock *lock, LM75_Version ver, uint8_t addr, float low_lim, float upp_lim);
+LM75_Status LM75_InitRaw(LM75 *dev, LM75_Cold *cold, LM75_Bus *hi2c, LM75_BusLock *lock, LM75_Version ver, uint8_t addr, uint16_t thyst_raw, uint16_t tos_raw);
 LM75_Status LM75_SetHysteresis(LM75 *dev, float low_lim);
 LM75_Status LM75_SetOverTemperatureShutdown(LM75 *dev, float upp_lim);
 LM75_Status LM75_GetTemperature(LM75 *dev);
+LM75_Status LM75_GetTemperatureAt(LM75 *dev, LM75_Bus *bus, LM75_BusLock *lock, uint8_t addr, LM75_Version ver);
 LM75_Status LM75_ShutdownEnable(LM75 *dev);
 LM75_Status LM75_ShutdownDisable(LM75 *dev);
 LM75_Status LM75_SetConfiguration(LM75 *dev, uint8_t reg_val);
+LM75_Status LM75_SetConfig(LM75 *dev, const LM75_Config *cfg);
+LM75_Status LM75_GetConfig(const LM75 *dev, LM75_Config *cfg);
+LM75_Status LM75_SyncConfig(LM75 *dev);
+LM75_Status LM75_GetTemperature_IT(LM75 *dev);
+LM75_Status LM75_GetTemperature_Async(LM75 *dev, LM75_Callback cb, void *ctx);
+LM75_Status LM75_GetTemperature_Wait(LM75 *dev, uint32_t timeout_ms);
+void LM75_SetBusLock(LM75 *dev, LM75_BusLock *lock);
+LM75_Status LM75_GetTemperatureCoarse(LM75 *dev, int8_t *dest);
+LM75_Status LM75_ConvertRaw(uint16_t raw_temp, LM75_Version ver, float *dest);
+LM75_Status LM75_ConvertRawFixed(uint16_t raw_temp, LM75_Version ver, int16_t *dest);
+LM75_Status LM75_ReadBatchRaw(LM75 *devs, uint16_t count, uint16_t *dest, LM75_Status *status);
+LM75_Status LM75_ReadBatchFixed(LM75 *devs, uint16_t count, int16_t *dest, LM75_Status *status);
+LM75_Status LM75_ReadBatchFloat(LM75 *devs, uint16_t count, float *dest, LM75_Status *status);
+LM75_Status LM75_SetLimitsRaw(LM75 *dev, uint16_t thyst_raw, uint16_t tos_raw);
+LM75_Status LM75_ReadRegister(LM75 *dev, uint8_t reg, uint8_t *dest, uint8_t size);
+LM75_Status LM75_WriteRegister(LM75 *dev, uint8_t reg, uint8_t *data, uint8_t size);
+
+/* LM75_ReadTemp, LM75_ReadConf, LM75_WriteConf, ... generated from the register map, see lm75_regs.h */
+LM75_REGISTERS(LM75_REG_ACCESSORS)
+
+#if defined(LM75_USE_SIM)
+/* Interrupt driven reads of simulated sensors complete before returning */
+#elif defined(LM75_USE_LL)
+/* Call from the I2C interrupt handler while a read of this sensor is pending */
+void LM75_IRQHandler(LM75 *dev);
+#else
+/* Call from HAL_I2C_MemRxCpltCallback, HAL_I2C_MasterRxCpltCallback and HAL_I2C_ErrorCallback for this sensor */
+void LM75_RxCpltCallback(LM75 *dev);
+void LM75_ErrorCallback(LM75 *dev);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
 
 
 #endif
\ No newline at end of file
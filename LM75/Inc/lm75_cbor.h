@@ -0,0 +1,70 @@
+/*******************************************************
+ * File Name: lm75_cbor.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 CBOR sample encoder.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_CBOR__
+#define __LM75_CBOR__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Integer keys of a batch map */
+#define LM75_CBOR_KEY_TIME          0
+#define LM75_CBOR_KEY_EXP           1
+#define LM75_CBOR_KEY_VALUES        2
+
+/* Largest encoding of a batch of count samples */
+#define LM75_CBOR_BATCH_MAX(count)  ( 13 + 3 * (count) )
+
+
+/*
+ * Writes a CBOR sequence of batches into a caller buffer, one map per batch:
+ *   { 0: timestamp, 1: exponent, 2: [ m0, m1, ... ] }
+ * Sample i is mi * 2^exponent degrees celsius, taken straight from the raw register value,
+ * or null if its read failed. Nothing is written past size; once full the encoder stays failed.
+ */
+typedef struct {
+    /* Output buffer */
+    uint8_t *buf;
+    uint32_t size;
+
+    /* Bytes written */
+    uint32_t len;
+
+    /* Samples still expected by the open batch */
+    uint16_t pending;
+
+    /* Raw value shift of the open batch */
+    uint8_t shift;
+
+    /* A write did not fit in the buffer */
+    bool overflow;
+} LM75_Cbor;
+
+
+void LM75_Cbor_Init(LM75_Cbor *enc, uint8_t *buf, uint32_t size);
+void LM75_Cbor_Reset(LM75_Cbor *enc);
+LM75_Status LM75_Cbor_BeginBatch(LM75_Cbor *enc, uint32_t timestamp, uint16_t count, LM75_Version ver);
+LM75_Status LM75_Cbor_AddRaw(LM75_Cbor *enc, uint16_t raw_temp, LM75_Status status);
+LM75_Status LM75_Cbor_EncodeBatch(LM75_Cbor *enc, uint32_t timestamp, const uint16_t *raw, const LM75_Status *status, uint16_t count, LM75_Version ver);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
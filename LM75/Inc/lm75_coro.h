@@ -0,0 +1,345 @@
+/*******************************************************
+ * File Name: lm75_coro.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header-only C++20 coroutine layer over LM75_GetTemperature_Async:
+ *              an awaitable read, a single-threaded executor and a fixed pool of coroutine frames.
+ *
+ * Usage:
+ *
+ *     LM75_Executor exec;
+ *     LM75_Sensor board(sensor, exec);
+ *
+ *     LM75_Task poll(LM75_Sensor &s)
+ *     {
+ *         if (LM75_OK == co_await s.read()) { use(s.dev().temp_c); }
+ *     }
+ *
+ *     exec.spawn(poll(board));
+ *     exec.run();
+ *
+ * A coroutine is resumed by LM75_Executor::run, never from the interrupt that ends its read:
+ * the completion callback only queues it. Frames come from a static pool of LM75_CORO_FRAMES
+ * slots of LM75_CORO_FRAME_SIZE bytes, nothing is allocated from the heap. When no slot fits,
+ * the coroutine call returns an empty task and LM75_Executor::spawn fails.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_CORO__
+#define __LM75_CORO__
+
+
+#if !defined(__cplusplus) || __cplusplus < 202002L
+#error "lm75_coro.h needs C++20"
+#endif
+
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+
+
+#include "lm75.h"
+
+
+/* Number of coroutine frames alive at once, also the depth of the executor run queues */
+#ifndef LM75_CORO_FRAMES
+#define LM75_CORO_FRAMES        8
+#endif
+
+/* Size of one frame slot, a coroutine with a larger frame cannot be created */
+#ifndef LM75_CORO_FRAME_SIZE
+#define LM75_CORO_FRAME_SIZE    256
+#endif
+
+static_assert(LM75_CORO_FRAMES > 0 && LM75_CORO_FRAMES < UINT32_MAX, "LM75_CORO_FRAMES out of range");
+static_assert(LM75_CORO_FRAME_SIZE >= sizeof(void *), "LM75_CORO_FRAME_SIZE out of range");
+
+
+/*
+ * Static frame slots handed out by LM75_Task::promise_type, used from the executor thread only.
+ * Given back slots form an intrusive free list through their first bytes, slots never used yet
+ * are taken in order, so take and give are O(1) at any pool size.
+ */
+class LM75_FramePool {
+public:
+    static void *take(std::size_t size) noexcept
+    {
+        void *frame = nullptr;
+
+        if (size > LM75_CORO_FRAME_SIZE)
+        {
+            return nullptr;
+        }
+
+        if (nullptr != free_)
+        {
+            frame = free_;
+            free_ = free_->next;
+        }
+        else if (fresh_ < LM75_CORO_FRAMES)
+        {
+            frame = slots_[fresh_++].bytes;
+        }
+        else
+        {
+            return nullptr;
+        }
+
+        in_use_++;
+
+        return frame;
+    }
+
+    static void give(void *frame) noexcept
+    {
+        Free *slot = static_cast<Free *>(frame);
+
+        slot->next = free_;
+        free_ = slot;
+        in_use_--;
+    }
+
+    /* Frames in use, 0 once every task has finished */
+    static std::size_t in_use() noexcept { return in_use_; }
+
+private:
+    struct Slot {
+        alignas(std::max_align_t) unsigned char bytes[LM75_CORO_FRAME_SIZE];
+    };
+
+    struct Free {
+        Free *next;
+    };
+
+    static inline Slot slots_[LM75_CORO_FRAMES];
+    static inline Free *free_ = nullptr;
+    static inline std::size_t fresh_ = 0;
+    static inline std::size_t in_use_ = 0;
+};
+
+
+/* Fire and forget coroutine, started and resumed by LM75_Executor */
+class LM75_Task {
+public:
+    struct promise_type {
+        static void *operator new(std::size_t size) noexcept
+        {
+            return LM75_FramePool::take(size);
+        }
+
+        static void operator delete(void *frame) noexcept
+        {
+            LM75_FramePool::give(frame);
+        }
+
+        /* No slot left: the call returns an empty task instead of throwing */
+        static LM75_Task get_return_object_on_allocation_failure() noexcept
+        {
+            return LM75_Task();
+        }
+
+        LM75_Task get_return_object() noexcept
+        {
+            return LM75_Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        /* Started by the executor, kept after the end so the executor can destroy it */
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept {}
+
+        /* Built without exceptions on the target */
+        void unhandled_exception() noexcept {}
+    };
+
+    LM75_Task() noexcept = default;
+
+    explicit LM75_Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    LM75_Task(LM75_Task &&other) noexcept : handle_(other.handle_)
+    {
+        other.handle_ = nullptr;
+    }
+
+    LM75_Task(const LM75_Task &) = delete;
+    LM75_Task &operator=(const LM75_Task &) = delete;
+    LM75_Task &operator=(LM75_Task &&) = delete;
+
+    /* A task never given to an executor is destroyed unstarted */
+    ~LM75_Task()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    /* Hand the coroutine over, the task no longer owns it */
+    std::coroutine_handle<> release() noexcept
+    {
+        std::coroutine_handle<> handle = handle_;
+
+        handle_ = nullptr;
+
+        return handle;
+    }
+
+    explicit operator bool() const noexcept { return static_cast<bool>(handle_); }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+
+/*
+ * Single-threaded executor with two run queues: spawned tasks, touched by the thread only, and
+ * resumed coroutines, pushed by read completions from interrupt context and popped by run.
+ * Completions must come from interrupts of one priority (or from the thread, as on the simulated
+ * bus), so the resumed queue has a single producer. A task is queued at most once at a time,
+ * so neither queue overflows.
+ */
+class LM75_Executor {
+public:
+    /* Queue a new task to start on the next run, false for an empty task; thread only */
+    bool spawn(LM75_Task &&task) noexcept
+    {
+        std::coroutine_handle<> handle = task.release();
+
+        if (!handle)
+        {
+            return false;
+        }
+
+        live_++;
+        spawned_[spawn_tail_] = handle;
+        spawn_tail_ = next(spawn_tail_);
+
+        return true;
+    }
+
+    /* Queue a suspended coroutine, called by the completion of its read, from interrupt context */
+    void post(std::coroutine_handle<> handle) noexcept
+    {
+        std::uint32_t tail = tail_.load(std::memory_order_relaxed);
+
+        queue_[tail] = handle;
+        tail_.store(next(tail), std::memory_order_release);
+    }
+
+    /* Resume queued coroutines until none is ready, returns the number of tasks still alive */
+    std::size_t run() noexcept
+    {
+        for (;;)
+        {
+            std::coroutine_handle<> handle;
+            std::uint32_t head = head_.load(std::memory_order_relaxed);
+
+            if (head != tail_.load(std::memory_order_acquire))
+            {
+                handle = queue_[head];
+                head_.store(next(head), std::memory_order_release);
+            }
+            else if (spawn_head_ != spawn_tail_)
+            {
+                handle = spawned_[spawn_head_];
+                spawn_head_ = next(spawn_head_);
+            }
+            else
+            {
+                return live_;
+            }
+
+            handle.resume();
+
+            if (handle.done())
+            {
+                handle.destroy();
+                live_--;
+            }
+        }
+    }
+
+    /* Tasks spawned and not finished */
+    std::size_t live() const noexcept { return live_; }
+
+private:
+    static constexpr std::uint32_t SIZE = LM75_CORO_FRAMES + 1;
+
+    static std::uint32_t next(std::uint32_t index) noexcept
+    {
+        return (index + 1 == SIZE) ? 0 : index + 1;
+    }
+
+    std::coroutine_handle<> queue_[SIZE] = {};
+    std::atomic<std::uint32_t> head_{0};
+    std::atomic<std::uint32_t> tail_{0};
+    std::coroutine_handle<> spawned_[SIZE] = {};
+    std::uint32_t spawn_head_ = 0;
+    std::uint32_t spawn_tail_ = 0;
+    std::size_t live_ = 0;
+};
+
+
+/* Awaitable interrupt driven Temp read, resumes with the read status, temp_c is updated on LM75_OK */
+class LM75_ReadAwaiter {
+public:
+    LM75_ReadAwaiter(LM75 &dev, LM75_Executor &exec) noexcept : dev_(dev), exec_(exec) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    /* Start the read, or resume at once with LM75_ERROR when it cannot start */
+    bool await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        handle_ = handle;
+
+        if (LM75_OK != LM75_GetTemperature_Async(&dev_, done, this))
+        {
+            status_ = LM75_ERROR;
+            return false;
+        }
+
+        return true;
+    }
+
+    LM75_Status await_resume() const noexcept { return status_; }
+
+private:
+    /* Completion callback, queues the coroutine on its executor */
+    static void done(LM75 *dev, LM75_Status status, void *ctx)
+    {
+        LM75_ReadAwaiter *self = static_cast<LM75_ReadAwaiter *>(ctx);
+
+        (void)dev;
+        self->status_ = status;
+        self->exec_.post(self->handle_);
+    }
+
+    LM75 &dev_;
+    LM75_Executor &exec_;
+    std::coroutine_handle<> handle_;
+    LM75_Status status_ = LM75_ERROR;
+};
+
+
+/* Sensor bound to the executor that resumes its readers: co_await sensor.read() */
+class LM75_Sensor {
+public:
+    LM75_Sensor(LM75 &dev, LM75_Executor &exec) noexcept : dev_(dev), exec_(exec) {}
+
+    LM75_ReadAwaiter read() noexcept { return LM75_ReadAwaiter(dev_, exec_); }
+
+    LM75 &dev() noexcept { return dev_; }
+
+private:
+    LM75 &dev_;
+    LM75_Executor &exec_;
+};
+
+
+#endif
@@ -0,0 +1,84 @@
+/*******************************************************
+ * File Name: lm75_energy.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 energy and duty-cycle accounting.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_ENERGY__
+#define __LM75_ENERGY__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Typical supply currents of the LM75 datasheet in nA, check the datasheet of the part used */
+#define LM75_I_ACTIVE_NA            250000UL
+#define LM75_I_SHUTDOWN_NA          1000UL
+
+
+/* Time spent by a sensor in each state, filled when attached to the sensor */
+struct LM75_Energy {
+    /* I2C clock frequency in Hz, used to turn bus bits into time */
+    uint32_t bus_hz;
+
+    /* LM75_TIMESTAMP() ticks per second */
+    uint32_t ts_hz;
+
+    /* Supply currents in nA and supply voltage in mV */
+    uint32_t i_active_na;
+    uint32_t i_shutdown_na;
+    uint32_t supply_mv;
+
+    /* Current state and the time it was entered */
+    bool shutdown;
+    uint32_t since;
+
+    /* Accumulated time in each state, LM75_TIMESTAMP() ticks */
+    uint64_t active_ticks;
+    uint64_t shutdown_ticks;
+
+    /* Bits clocked on the bus to or from the sensor, and number of transfers */
+    uint64_t bus_bits;
+    uint32_t transfers;
+};
+
+
+/* Figures of LM75_Energy_Report */
+typedef struct {
+    /* Time in conversion and in shutdown, LM75_TIMESTAMP() ticks */
+    uint64_t active_ticks;
+    uint64_t shutdown_ticks;
+
+    /* Share of time in conversion, 1/65536 */
+    uint16_t duty;
+
+    /* Bus time spent on the sensor in us */
+    uint64_t bus_us;
+
+    /* Estimated energy used by the sensor in uJ */
+    uint64_t energy_uj;
+} LM75_EnergyReport;
+
+
+void LM75_Energy_Attach(LM75_Energy *energy, LM75 *dev, uint32_t bus_hz, uint32_t ts_hz, uint32_t supply_mv);
+void LM75_Energy_OnShutdown(LM75_Energy *energy, bool shutdown, uint32_t now);
+void LM75_Energy_OnTransfer(LM75_Energy *energy, uint16_t bytes, uint8_t conditions);
+void LM75_Energy_Report(const LM75_Energy *energy, uint32_t now, LM75_EnergyReport *report);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
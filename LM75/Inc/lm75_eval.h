@@ -0,0 +1,61 @@
+/*******************************************************
+ * File Name: lm75_eval.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the batch Tos/Thyst evaluation kernel.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_EVAL__
+#define __LM75_EVAL__
+
+
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Number of 32-bit words of a bitmask covering n sensors */
+#define LM75_EVAL_WORDS(n)      ( ((n) + 31) / 32 )
+
+
+/*
+ * Thresholds and O.S. state of n sensors stored as structure of arrays.
+ * Temperatures and thresholds are fixed point in 1/256 degree celsius (see LM75_ConvertRawFixed).
+ * Bit i of a bitmask word w refers to sensor 32 * w + i.
+ */
+typedef struct {
+    /* Number of sensors */
+    uint32_t n;
+
+    /* Tos and Thyst of each sensor */
+    const int16_t *tos;
+    const int16_t *thyst;
+
+    /* Fault queue length of each sensor, 1 to 6 */
+    const uint8_t *queue;
+
+    /* Consecutive faults counted so far, n entries */
+    uint8_t *count;
+
+    /* O.S. output state, LM75_EVAL_WORDS(n) words */
+    uint32_t *active;
+} LM75_EvalSet;
+
+
+void LM75_Eval_Reset(LM75_EvalSet *set);
+void LM75_Eval(LM75_EvalSet *set, const int16_t *temp, uint32_t *rising, uint32_t *falling);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,111 @@
+/*******************************************************
+ * File Name: lm75_fault.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 bus fault injection, for test builds.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_FAULT__
+#define __LM75_FAULT__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Rule field value matching any address or register */
+#define LM75_FAULT_ANY              0xFF
+
+/* Probability of a rule in 1/65536 per matching transfer, LM75_FAULT_PROB(1.0) (0xFFFF) matches every transfer */
+#define LM75_FAULT_PROB(p)          ( (uint16_t)((p) * 65535.0f) )
+
+
+/* Fault injected into a transfer */
+typedef enum {
+    /* Transfer made normally */
+    LM75_FAULT_NONE,
+
+    /* Address or data not acknowledged, nothing transferred */
+    LM75_FAULT_NACK,
+
+    /* Bus stuck, the transfer fails after the driver timeout; an interrupt driven read on a target never ends */
+    LM75_FAULT_TIMEOUT,
+
+    /* Arbitration lost to another master, the driver retries up to 3 times once the bus is free */
+    LM75_FAULT_ARB_LOST,
+
+    /* Transfer reported successful but one bit of the data is flipped */
+    LM75_FAULT_CORRUPT,
+
+    LM75_FAULT_CLASSES
+} LM75_FaultClass;
+
+
+/* Direction matched by a rule */
+typedef enum {
+    LM75_FAULT_DIR_ANY,
+    LM75_FAULT_DIR_READ,
+    LM75_FAULT_DIR_WRITE
+} LM75_FaultDir;
+
+
+/*
+ * A rule applies to the transfers matching its address, register and direction.
+ * With a script, the n-th matching transfer gets script[n] (LM75_FaultClass) until the
+ * script ends; otherwise fault is injected with probability prob.
+ */
+typedef struct {
+    /* 7-bit sensor address and register pointer, LM75_FAULT_ANY for all */
+    uint8_t addr;
+    uint8_t reg;
+
+    /* LM75_FaultDir */
+    uint8_t dir;
+
+    /* LM75_FaultClass injected by probability */
+    uint8_t fault;
+    uint16_t prob;
+
+    /* Fault sequence, NULL to use the probability */
+    const uint8_t *script;
+    uint16_t script_len;
+    uint16_t script_pos;
+} LM75_FaultRule;
+
+
+/* Rules checked in order, the first matching rule decides, and what was injected */
+typedef struct {
+    LM75_FaultRule *rules;
+    uint16_t count;
+
+    /* State of the pseudo random generator, never 0 */
+    uint32_t seed;
+
+    /* Transfers seen and faults injected per class */
+    uint32_t transfers;
+    uint32_t injected[LM75_FAULT_CLASSES];
+} LM75_FaultSet;
+
+
+LM75_Status LM75_Fault_Init(LM75_FaultSet *set, LM75_FaultRule *rules, uint16_t count, uint32_t seed);
+void LM75_Fault_Install(LM75_FaultSet *set);
+
+/* Called by the driver around every transfer, blocking or interrupt driven, when built with LM75_FAULT_INJECTION */
+LM75_FaultClass LM75_Fault_Inject(uint8_t addr, uint8_t reg, bool write);
+void LM75_Fault_Corrupt(uint8_t *data, uint16_t size);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,204 @@
+/*******************************************************
+ * File Name: lm75_fleet.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header generating unrolled init and scan code from a compile-time LM75 fleet table.
+ *
+ * Usage: define the table, then include this header once per source file:
+ *
+ *     #define LM75_FLEET(X) \
+ *         X(board, hi2c1, 0x48, LM75_11BIT, 40.0f, 60.0f) \
+ *         X(psu,   hi2c1, 0x49, LM75_9BIT,  50.0f, 80.0f)
+ *     #include "lm75_fleet.h"
+ *
+ *     LM75 fleet[LM75_FLEET_COUNT];
+ *     LM75_Cold fleet_cold[LM75_FLEET_COUNT];
+ *     LM75_Fleet_Init(fleet, fleet_cold);
+ *     LM75_Fleet_Scan(fleet);
+ *     fleet[LM75_FLEET_ID_psu].temp_c;
+ *
+ * Entries are X(name, bus, addr, ver, thyst_c, tos_c), bus is the identifier of the
+ * LM75_Bus object and addr any constant expression. Included from C++14 or later, a constexpr
+ * table of bus names and address values is checked by static_assert: two sensors with the
+ * same address value on the same bus (0x48 and 72, or 0x47 + 1) fail to compile. From C an
+ * address wider than 7 bits fails to compile too, but C has no way to compare the bus names
+ * at compile time, so LM75_Fleet_Init compares the values and fails before touching the bus.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_FLEET__
+#define __LM75_FLEET__
+
+
+#include "lm75.h"
+
+
+#ifndef LM75_FLEET
+#error "Define LM75_FLEET(X) before including lm75_fleet.h"
+#endif
+
+
+/* Lock of a bus held by every transfer from LM75_Fleet_Init on, e.g. #define LM75_FLEET_LOCK(bus) (&bus##_lock) */
+#ifndef LM75_FLEET_LOCK
+#define LM75_FLEET_LOCK(bus)    NULL
+#endif
+
+
+/* Sensor indexes and fleet size */
+#define LM75_FLEET_ID(name, bus, addr, ver, thyst_c, tos_c)         LM75_FLEET_ID_##name,
+enum { LM75_FLEET(LM75_FLEET_ID) LM75_FLEET_COUNT };
+
+/* Thyst and Tos register values encoded at compile time */
+#define LM75_FLEET_LIMITS(name, bus, addr, ver, thyst_c, tos_c)     { LM75_LIMIT_ENCODE(thyst_c), LM75_LIMIT_ENCODE(tos_c) },
+static const uint16_t lm75_fleet_limits[LM75_FLEET_COUNT][2] = { LM75_FLEET(LM75_FLEET_LIMITS) };
+
+
+#if defined(__cplusplus) && __cplusplus >= 201402L
+
+/* Bus name and address value of a fleet entry, for the compile-time checks */
+struct LM75_FleetAddr {
+    const char *bus;
+    unsigned long addr;
+};
+
+#define LM75_FLEET_ENTRY(name, bus, addr, ver, thyst_c, tos_c)      { #bus, (unsigned long)(addr) },
+static constexpr LM75_FleetAddr lm75_fleet_addrs[LM75_FLEET_COUNT] = { LM75_FLEET(LM75_FLEET_ENTRY) };
+
+/* Same bus identifier */
+static constexpr bool lm75_fleet_same_bus(const char *a, const char *b)
+{
+    while (*a != '\0' && *a == *b)
+    {
+        a++;
+        b++;
+    }
+
+    return *a == *b;
+}
+
+/* Every address is a 7-bit value */
+static constexpr bool lm75_fleet_addrs_valid()
+{
+    for (unsigned i = 0; i < LM75_FLEET_COUNT; i++)
+    {
+        if (lm75_fleet_addrs[i].addr > 0x7F)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* No address value is used twice on the same bus */
+static constexpr bool lm75_fleet_addrs_unique()
+{
+    for (unsigned i = 1; i < LM75_FLEET_COUNT; i++)
+    {
+        for (unsigned j = 0; j < i; j++)
+        {
+            if (lm75_fleet_addrs[i].addr == lm75_fleet_addrs[j].addr &&
+                lm75_fleet_same_bus(lm75_fleet_addrs[i].bus, lm75_fleet_addrs[j].bus))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static_assert(lm75_fleet_addrs_valid(), "LM75_FLEET: address is not a 7-bit value");
+static_assert(lm75_fleet_addrs_unique(), "LM75_FLEET: two sensors have the same address on the same bus");
+
+#else
+
+/* Every address is a 7-bit value, a wider one would be truncated by the uint8_t address arguments */
+#define LM75_FLEET_ADDR_CHECK(name, bus, addr, ver, thyst_c, tos_c) \
+    typedef char lm75_fleet_addr_7bit_##name[((unsigned long)(addr) <= 0x7FUL) ? 1 : -1];
+LM75_FLEET(LM75_FLEET_ADDR_CHECK)
+
+/* Bus and address value of every sensor, for the duplicate check of LM75_Fleet_Init */
+#define LM75_FLEET_BUS(name, bus, addr, ver, thyst_c, tos_c)        &(bus),
+#define LM75_FLEET_ADDR(name, bus, addr, ver, thyst_c, tos_c)       (unsigned long)(addr),
+
+#endif
+
+
+/* Initialise every sensor of the fleet with its pre-encoded limits, the per-sensor calls are unrolled */
+static inline LM75_Status LM75_Fleet_Init(LM75 *devs, LM75_Cold *colds)
+{
+    LM75_Status status = LM75_OK;
+
+#ifndef __cplusplus
+    const LM75_Bus *const buses[LM75_FLEET_COUNT] = { LM75_FLEET(LM75_FLEET_BUS) };
+    static const unsigned long addrs[LM75_FLEET_COUNT] = { LM75_FLEET(LM75_FLEET_ADDR) };
+
+    /* Same address value on the same bus, whatever its spelling */
+    for (unsigned i = 1; i < LM75_FLEET_COUNT; i++)
+    {
+        for (unsigned j = 0; j < i; j++)
+        {
+            if (buses[i] == buses[j] && addrs[i] == addrs[j])
+            {
+                return LM75_ERROR;
+            }
+        }
+    }
+#endif
+
+#define LM75_FLEET_INIT(name, bus, addr, ver, thyst_c, tos_c) \
+    if (LM75_OK != LM75_InitRaw(&devs[LM75_FLEET_ID_##name], &colds[LM75_FLEET_ID_##name], &(bus), LM75_FLEET_LOCK(bus), (ver), (addr), \
+                                lm75_fleet_limits[LM75_FLEET_ID_##name][0], lm75_fleet_limits[LM75_FLEET_ID_##name][1])) \
+    { \
+        status = LM75_ERROR; \
+    }
+
+    LM75_FLEET(LM75_FLEET_INIT)
+
+#undef LM75_FLEET_INIT
+
+    return status;
+}
+
+/* Write the pre-encoded limits of every sensor again, e.g. after a sensor lost power */
+static inline LM75_Status LM75_Fleet_SetLimits(LM75 *devs)
+{
+    LM75_Status status = LM75_OK;
+
+#define LM75_FLEET_SET_LIMITS(name, bus, addr, ver, thyst_c, tos_c) \
+    if (LM75_OK != LM75_SetLimitsRaw(&devs[LM75_FLEET_ID_##name], lm75_fleet_limits[LM75_FLEET_ID_##name][0], lm75_fleet_limits[LM75_FLEET_ID_##name][1])) \
+    { \
+        status = LM75_ERROR; \
+    }
+
+    LM75_FLEET(LM75_FLEET_SET_LIMITS)
+
+#undef LM75_FLEET_SET_LIMITS
+
+    return status;
+}
+
+/* Read the temperature of every sensor, each unrolled transfer gets its bus, lock, address byte and version from the table */
+static inline LM75_Status LM75_Fleet_Scan(LM75 *devs)
+{
+    LM75_Status status = LM75_OK;
+
+#define LM75_FLEET_SCAN(name, bus, addr, ver, thyst_c, tos_c) \
+    if (LM75_OK != LM75_GetTemperatureAt(&devs[LM75_FLEET_ID_##name], &(bus), LM75_FLEET_LOCK(bus), (uint8_t)((addr) << 1), (ver))) \
+    { \
+        status = LM75_ERROR; \
+    }
+
+    LM75_FLEET(LM75_FLEET_SCAN)
+
+#undef LM75_FLEET_SCAN
+
+    return status;
+}
+
+
+#endif
@@ -0,0 +1,76 @@
+/*******************************************************
+ * File Name: lm75_health.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 health tracking.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_HEALTH__
+#define __LM75_HEALTH__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Health state of a sensor, worst first */
+typedef enum {
+    LM75_HEALTH_DEAD,
+    LM75_HEALTH_STUCK,
+    LM75_HEALTH_DEGRADED,
+    LM75_HEALTH_OK
+} LM75_HealthState;
+
+
+/* Health of one sensor, updated in constant time on each read */
+typedef struct {
+    /* Averages cover about 1 << shift reads */
+    uint8_t shift;
+
+    /* Below this success rate (1/65536) the sensor is degraded */
+    uint16_t min_success;
+
+    /* This many identical readings without any variance mark the sensor stuck */
+    uint16_t stuck_reads;
+
+    /* Without a good reading for this long (LM75_TIMESTAMP() units) the sensor is dead */
+    uint32_t max_age;
+
+    /* Moving average of the read success, 1/65536 */
+    uint16_t success;
+
+    /* Moving mean and variance of the raw Temp value */
+    int32_t mean;
+    uint32_t var;
+
+    /* Last good raw value and number of identical readings in a row */
+    uint16_t last_raw;
+    uint16_t same;
+
+    /* Time of the last good reading */
+    uint32_t last_good_ts;
+
+    /* Current state */
+    LM75_HealthState state;
+} LM75_Health;
+
+
+void LM75_Health_Init(LM75_Health *health, uint8_t shift, uint16_t min_success, uint16_t stuck_reads, uint32_t max_age, uint32_t now);
+bool LM75_Health_Update(LM75_Health *health, LM75_Status status, uint16_t raw_temp, uint32_t now);
+bool LM75_Health_Check(LM75_Health *health, uint32_t now);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,69 @@
+/*******************************************************
+ * File Name: lm75_hist.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the raw value temperature histograms.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_HIST__
+#define __LM75_HIST__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Bin widths as shift of the raw register value */
+#define LM75_HIST_0_125C            5
+#define LM75_HIST_0_5C              7
+#define LM75_HIST_1C                8
+
+/* Largest export of a histogram with nbins bins */
+#define LM75_HIST_EXPORT_MAX(nbins) ( 6 + 3 * (nbins) )
+
+/* Largest number of bins, so that LM75_HIST_EXPORT_MAX fits the uint16_t size of LM75_Hist_Export */
+#define LM75_HIST_MAX_BINS          ( (0xFFFF - 6) / 3 )
+
+
+/*
+ * Histogram indexed directly by the raw Temp register value.
+ * Bin i counts readings with (raw >> shift) == base + i, the first and last bins
+ * also collect readings below and above the range.
+ */
+typedef struct {
+    /* Counters, nbins entries */
+    uint16_t *bins;
+    uint16_t nbins;
+
+    /* Bin index of bins[0] */
+    int16_t base;
+
+    /* Bin width is 1 << shift raw units, 1/256 degree each */
+    uint8_t shift;
+
+    /* Counters were halved this many times on overflow */
+    uint8_t scale;
+} LM75_Hist;
+
+
+LM75_Status LM75_Hist_Init(LM75_Hist *hist, uint16_t *bins, uint16_t nbins, uint8_t shift, float low_c);
+void LM75_Hist_Add(LM75_Hist *hist, uint16_t raw_temp);
+void LM75_Hist_Update(LM75_Hist *hist, const LM75 *dev, LM75_Status status);
+void LM75_Hist_Clear(LM75_Hist *hist);
+uint16_t LM75_Hist_Export(const LM75_Hist *hist, uint8_t *dest, uint16_t size);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
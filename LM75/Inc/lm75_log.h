@@ -0,0 +1,206 @@
+/*******************************************************
+ * File Name: lm75_log.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 compressed columnar sample log.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_LOG__
+#define __LM75_LOG__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Samples per block, a block is the unit of skipping */
+#ifndef LM75_LOG_BLOCK_SAMPLES
+#define LM75_LOG_BLOCK_SAMPLES      256
+#endif
+
+/* Column lengths are 16-bit in the block header */
+#if LM75_LOG_BLOCK_SAMPLES < 1 || LM75_LOG_BLOCK_SAMPLES > 14000
+#error "LM75_LOG_BLOCK_SAMPLES must be between 1 and 14000"
+#endif
+
+/* Block header size and format version */
+#define LM75_LOG_HEADER_SIZE        32
+#define LM75_LOG_VERSION            2
+
+/* Header size of a saved index, a multiple of 8 so the entries after it stay aligned */
+#define LM75_LOG_INDEX_HEADER_SIZE  24
+
+/* Largest columns of a block: 36 bits per timestamp and 21 bits per value at worst */
+#define LM75_LOG_TS_COL_MAX         ( (36 * LM75_LOG_BLOCK_SAMPLES + 7) / 8 )
+#define LM75_LOG_VAL_COL_MAX        ( (21 * LM75_LOG_BLOCK_SAMPLES + 7) / 8 )
+
+
+/*
+ * Log of one sensor, a sequence of blocks:
+ *   header: "L7", version, shift, count, ts column bytes, value column bytes, reserved,
+ *           first timestamp, first value, reserved, last timestamp,
+ *           min, max and sum of the raw values (little endian)
+ *   timestamp column: delta of delta of each following timestamp, prefix coded bits
+ *   value column: delta of each following raw value in steps of 1 << shift, prefix coded bits
+ * A steady sample period and an unchanged temperature cost 2 bits per sample.
+ */
+
+
+/* Output of the writer, called with consecutive parts of each finished block */
+typedef LM75_Status (*LM75_LogSink)(void *ctx, const uint8_t *data, uint32_t len);
+
+
+/* Bits appended to a column */
+typedef struct {
+    uint8_t *buf;
+    uint32_t bits;
+} LM75_LogBits;
+
+
+/* Append-only writer, one block is built in place and emitted when full */
+typedef struct {
+    LM75_LogSink sink;
+    void *ctx;
+
+    /* Weight of the lowest valid raw bit */
+    uint8_t shift;
+
+    /* Samples in the block being built */
+    uint16_t count;
+
+    /* First and last sample of the block and last timestamp delta */
+    uint32_t first_ts;
+    uint32_t last_ts;
+    int32_t last_delta;
+    int16_t first_val;
+    int16_t last_val;
+
+    /* Summary of the block in steps */
+    int16_t min_val;
+    int16_t max_val;
+    int32_t sum_val;
+
+    /* Columns of the block being built */
+    LM75_LogBits ts_col;
+    LM75_LogBits val_col;
+    uint8_t header[LM75_LOG_HEADER_SIZE];
+    uint8_t ts_buf[LM75_LOG_TS_COL_MAX];
+    uint8_t val_buf[LM75_LOG_VAL_COL_MAX];
+} LM75_LogWriter;
+
+
+/* Decoded block header */
+typedef struct {
+    uint8_t shift;
+    uint16_t count;
+    uint16_t ts_len;
+    uint16_t val_len;
+    uint32_t first_ts;
+    uint32_t last_ts;
+    int16_t first_val;
+
+    /* Summary of the samples, raw register values read as signed, i.e. 1/256 degree celsius */
+    int16_t min;
+    int16_t max;
+    int32_t sum;
+} LM75_LogHeader;
+
+
+/*
+ * Position of a block in a log, every block is a keyframe decodable on its own.
+ * Saved as is by LM75_Log_SaveIndex, so a saved index is used in place on hosts of the same byte order.
+ */
+typedef struct {
+    /* Offset of the block header */
+    uint64_t offset;
+
+    /* Number of samples before the block */
+    uint64_t first_sample;
+
+    /* Timestamps of the first and last samples of the block */
+    uint32_t first_ts;
+    uint32_t last_ts;
+
+    /* Summary of the block as in its header */
+    int64_t sum;
+    uint16_t count;
+    int16_t min;
+    int16_t max;
+    uint16_t reserved;
+} LM75_LogIndexEntry;
+
+
+/* Aggregate of the samples of a time range, raw register values read as signed */
+typedef struct {
+    /* Number of samples, min and max are only valid when not 0 */
+    uint64_t count;
+    int64_t sum;
+    int16_t min;
+    int16_t max;
+
+    /* Blocks decoded because the range cut through them, the others were answered by their summary */
+    uint32_t decoded;
+} LM75_LogAggregate;
+
+
+/* Streaming reader of a log held or mapped in memory, samples are decoded in place */
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+
+    /* Offset of the next block header */
+    size_t next;
+
+    /* Block being read and position in it */
+    LM75_LogHeader block;
+    const uint8_t *ts_col;
+    const uint8_t *val_col;
+    uint32_t ts_bit;
+    uint32_t val_bit;
+    uint16_t index;
+
+    /* Last decoded sample and timestamp delta */
+    uint32_t ts;
+    int32_t delta;
+    int16_t val;
+
+    /* A block header or column did not decode */
+    bool corrupt;
+} LM75_LogReader;
+
+
+LM75_Status LM75_Log_WriterInit(LM75_LogWriter *writer, LM75_Version ver, LM75_LogSink sink, void *ctx);
+LM75_Status LM75_Log_Append(LM75_LogWriter *writer, uint32_t timestamp, uint16_t raw_temp);
+LM75_Status LM75_Log_Flush(LM75_LogWriter *writer);
+LM75_Status LM75_Log_ParseHeader(const uint8_t *data, size_t size, LM75_LogHeader *header);
+void LM75_Log_ReaderInit(LM75_LogReader *reader, const uint8_t *data, size_t size);
+bool LM75_Log_Next(LM75_LogReader *reader, uint32_t *timestamp, uint16_t *raw_temp);
+bool LM75_Log_SkipBlock(LM75_LogReader *reader);
+LM75_Status LM75_Log_BuildIndex(const uint8_t *data, size_t size, LM75_LogIndexEntry *entries, uint32_t max, uint32_t *count);
+LM75_Status LM75_Log_SeekSample(LM75_LogReader *reader, const LM75_LogIndexEntry *entries, uint32_t count, uint64_t sample);
+LM75_Status LM75_Log_SeekTime(LM75_LogReader *reader, const LM75_LogIndexEntry *entries, uint32_t count, uint32_t timestamp);
+LM75_Status LM75_Log_Aggregate(LM75_LogReader *reader, const LM75_LogIndexEntry *entries, uint32_t count, uint32_t from, uint32_t to, LM75_LogAggregate *result);
+LM75_Status LM75_Log_SaveIndex(const LM75_LogIndexEntry *entries, uint32_t count, uint64_t log_size, LM75_LogSink sink, void *ctx);
+LM75_Status LM75_Log_LoadIndex(const uint8_t *data, size_t size, uint64_t log_size, const LM75_LogIndexEntry **entries, uint32_t *count);
+
+/* Define LM75_LOG_MMAP on a POSIX host to map a log file read-only, the reader then works on the mapping without copying it */
+#ifdef LM75_LOG_MMAP
+LM75_Status LM75_Log_MapFile(const char *path, const uint8_t **data, size_t *size);
+void LM75_Log_UnmapFile(const uint8_t *data, size_t size);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
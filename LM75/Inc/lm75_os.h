@@ -0,0 +1,131 @@
+/*******************************************************
+ * File Name: lm75_os.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing the OS abstraction used by the LM75 driver:
+ *              per-bus locks and completion notification of interrupt driven reads.
+ *              Select the port with LM75_OS, no locking by default.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_OS__
+#define __LM75_OS__
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/* Available ports */
+#define LM75_OS_NONE        0
+#define LM75_OS_FREERTOS    1
+#define LM75_OS_CMSIS2      2
+#define LM75_OS_POSIX       3
+
+#ifndef LM75_OS
+#define LM75_OS             LM75_OS_NONE
+#endif
+
+
+#if LM75_OS == LM75_OS_FREERTOS
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+#elif LM75_OS == LM75_OS_CMSIS2
+#include "cmsis_os2.h"
+#elif LM75_OS == LM75_OS_POSIX
+#include <pthread.h>
+#endif
+
+
+/* Thread flag used by the CMSIS-RTOS2 port to signal completion */
+#ifndef LM75_OS_FLAG
+#define LM75_OS_FLAG        0x00000100UL
+#endif
+
+/* Task notification index used by the FreeRTOS port, index 0 is left to the application */
+#ifndef LM75_OS_NOTIFY_INDEX
+#define LM75_OS_NOTIFY_INDEX        1
+#endif
+
+#if LM75_OS == LM75_OS_FREERTOS && LM75_OS_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES
+#error "Set configTASK_NOTIFICATION_ARRAY_ENTRIES above LM75_OS_NOTIFY_INDEX"
+#endif
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#if LM75_OS == LM75_OS_FREERTOS
+
+/* Mutex shared by all sensors of one bus, with priority inheritance */
+typedef struct {
+    SemaphoreHandle_t mutex;
+} LM75_BusLock;
+
+/* Task waiting for a read, woken by a direct task notification */
+typedef struct {
+    TaskHandle_t task;
+} LM75_OS_Waiter;
+
+#elif LM75_OS == LM75_OS_CMSIS2
+
+/* Mutex shared by all sensors of one bus, with priority inheritance */
+typedef struct {
+    osMutexId_t mutex;
+} LM75_BusLock;
+
+/* Thread waiting for a read, woken by LM75_OS_FLAG */
+typedef struct {
+    osThreadId_t thread;
+} LM75_OS_Waiter;
+
+#elif LM75_OS == LM75_OS_POSIX
+
+/* Mutex shared by all sensors of one bus, with priority inheritance */
+typedef struct {
+    pthread_mutex_t mutex;
+} LM75_BusLock;
+
+/* Thread waiting for a read */
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool done;
+} LM75_OS_Waiter;
+
+#else
+
+/* No OS: nothing to lock */
+typedef struct {
+    uint8_t unused;
+} LM75_BusLock;
+
+/* No OS: the caller polls the flag */
+typedef struct {
+    volatile bool done;
+} LM75_OS_Waiter;
+
+#endif
+
+
+bool LM75_OS_LockInit(LM75_BusLock *lock);
+void LM75_OS_Lock(LM75_BusLock *lock);
+void LM75_OS_Unlock(LM75_BusLock *lock);
+void LM75_OS_WaiterInit(LM75_OS_Waiter *waiter);
+void LM75_OS_WaiterDeinit(LM75_OS_Waiter *waiter);
+void LM75_OS_Notify(LM75_OS_Waiter *waiter);
+bool LM75_OS_Wait(LM75_OS_Waiter *waiter, uint32_t timeout_ms);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
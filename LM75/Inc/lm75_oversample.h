@@ -0,0 +1,70 @@
+/*******************************************************
+ * File Name: lm75_oversample.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 oversampling mode.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_OVERSAMPLE__
+#define __LM75_OVERSAMPLE__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Time between two conversions of the sensor in LM75_TIMESTAMP() units, 100 ms typical for the LM75 */
+#ifndef LM75_OVERSAMPLE_INTERVAL
+#define LM75_OVERSAMPLE_INTERVAL    100
+#endif
+
+
+/*
+ * Average of count interrupt driven reads, one per conversion interval.
+ * Reads are started by LM75_Oversample_Poll and accumulated from the completion callback,
+ * the CPU is free in between. Averaging only gains resolution while the readings vary
+ * (noise or a slowly moving temperature), a perfectly steady input stays on its step.
+ */
+typedef struct {
+    /* Sensor read */
+    LM75 *dev;
+
+    /* Number of reads to make and spacing between their starts */
+    uint16_t count;
+    uint32_t interval;
+
+    /* Start time of the next read */
+    uint32_t next;
+
+    /* Reads started, completed and successful */
+    uint16_t started;
+    volatile uint16_t done;
+    volatile uint16_t good;
+
+    /* Sum of the successful readings in 1/256 degree celsius */
+    volatile int32_t sum;
+
+    /* A read is in progress */
+    volatile bool busy;
+} LM75_Oversample;
+
+
+LM75_Status LM75_Oversample_Start(LM75_Oversample *os, LM75 *dev, uint16_t count, uint32_t interval, uint32_t now);
+bool LM75_Oversample_Poll(LM75_Oversample *os, uint32_t now);
+LM75_Status LM75_Oversample_Result(const LM75_Oversample *os, int16_t *dest, uint16_t *good);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
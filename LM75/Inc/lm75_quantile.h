@@ -0,0 +1,74 @@
+/*******************************************************
+ * File Name: lm75_quantile.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the streaming quantile estimator (P2 algorithm).
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_QUANTILE__
+#define __LM75_QUANTILE__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Quantile levels in 1/65536, clamped to 0..0xFFFF so p = 1 gives the highest level instead of wrapping to 0 */
+#define LM75_P2_LEVEL(p)            ( ((p) >= 1.0f) ? (uint16_t)0xFFFF : ((p) <= 0.0f) ? (uint16_t)0 : (uint16_t)((p) * 65536.0f) )
+
+/* Size of an exported estimator */
+#define LM75_P2_EXPORT_SIZE         46
+
+
+/*
+ * Constant memory estimator of one quantile.
+ * Values are fixed point in 1/65536 degree celsius.
+ */
+typedef struct {
+    /* Estimated quantile level in 1/65536 */
+    uint16_t p;
+
+    /* Number of samples seen */
+    uint32_t count;
+
+    /* Marker heights, the first samples sorted while count < 5 */
+    int32_t q[5];
+
+    /* Marker positions, 0 based ranks */
+    uint32_t n[5];
+} LM75_P2;
+
+
+/* Median, 95th and 99th percentile of one sensor */
+typedef struct {
+    LM75_P2 p50;
+    LM75_P2 p95;
+    LM75_P2 p99;
+} LM75_Quantiles;
+
+
+void LM75_P2_Init(LM75_P2 *est, uint16_t p);
+void LM75_P2_Add(LM75_P2 *est, int32_t value);
+int32_t LM75_P2_Get(const LM75_P2 *est);
+void LM75_P2_Export(const LM75_P2 *est, uint8_t *dest);
+LM75_Status LM75_P2_Import(LM75_P2 *est, const uint8_t *src);
+LM75_Status LM75_P2_Merge(LM75_P2 *dest, const LM75_P2 *a, const LM75_P2 *b);
+
+void LM75_Quantiles_Init(LM75_Quantiles *qs);
+LM75_Status LM75_Quantiles_Update(LM75_Quantiles *qs, const LM75 *dev, LM75_Status status);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
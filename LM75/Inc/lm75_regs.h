@@ -0,0 +1,196 @@
+/*******************************************************
+ * File Name: lm75_regs.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing the LM75 register map, the tables every register access is generated from.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_REGS__
+#define __LM75_REGS__
+
+
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Registers of the sensor: X(NAME, Name, field, pointer, size, type, access)
+ *  - NAME and Name build the constant and accessor names, field the shadow member
+ *  - pointer is the pointer register value, size the length in bytes, MSB first
+ *  - access is RO or RW, writers and shadow copies are only generated for RW registers
+ */
+#define LM75_REGISTERS(X) \
+    X(TEMP,  Temp,  temp,  0x00, 2, uint16_t, RO) \
+    X(CONF,  Conf,  conf,  0x01, 1, uint8_t,  RW) \
+    X(THYST, Thyst, thyst, 0x02, 2, uint16_t, RW) \
+    X(TOS,   Tos,   tos,   0x03, 2, uint16_t, RW)
+
+
+/* Fields of the Conf register: X(NAME, position, width) */
+#define LM75_CONF_FIELDS(X) \
+    X(SHUTDOWN, 0, 1) \
+    X(MODE,     1, 1) \
+    X(POL,      2, 1) \
+    X(FAULTS,   3, 2)
+
+
+/* Sensor versions: X(version, shift), the raw Temp value holds a two's complement number in bits 15..shift */
+#define LM75_VERSIONS(X) \
+    X(LM75_9BIT,  7) \
+    X(LM75_11BIT, 5)
+
+
+/* Pointer register value and length of each register, e.g. LM75_TOS_REG and LM75_TOS_REG_SIZE */
+#define LM75_REG_PTR_ENUM(NAME, Name, field, ptr, size, type, access)   LM75_##NAME##_REG = (ptr),
+#define LM75_REG_SIZE_ENUM(NAME, Name, field, ptr, size, type, access)  LM75_##NAME##_REG_SIZE = (size),
+#define LM75_REG_SIZE_MEMBER(NAME, Name, field, ptr, size, type, access) uint8_t field[size];
+enum { LM75_REGISTERS(LM75_REG_PTR_ENUM) };
+enum { LM75_REGISTERS(LM75_REG_SIZE_ENUM) };
+
+/* Length of the longest register, sizes a buffer able to hold any of them */
+typedef union { LM75_REGISTERS(LM75_REG_SIZE_MEMBER) } LM75_RegBuf;
+enum { LM75_REG_MAX_SIZE = sizeof(LM75_RegBuf) };
+
+
+/* Position and mask of each Conf field, e.g. LM75_CONF_FAULTS_POS and LM75_CONF_FAULTS_MASK */
+#define LM75_CONF_FIELD_ENUM(NAME, pos, width) \
+    LM75_CONF_##NAME##_POS = (pos), \
+    LM75_CONF_##NAME##_MASK = (((1 << (width)) - 1) << (pos)),
+#define LM75_CONF_FIELD_OR(NAME, pos, width)    | LM75_CONF_##NAME##_MASK
+enum {
+    LM75_CONF_FIELDS(LM75_CONF_FIELD_ENUM)
+    LM75_CONF_MASK = 0 LM75_CONF_FIELDS(LM75_CONF_FIELD_OR)
+};
+
+/* Shutdown bit, kept under its historical name */
+#define LM75_CONF_SHUTDOWN      LM75_CONF_SHUTDOWN_MASK
+
+/* Extract or place a Conf field value, e.g. LM75_CONF_GET(FAULTS, reg) */
+#define LM75_CONF_GET(NAME, reg_val)    ( ((reg_val) & LM75_CONF_##NAME##_MASK) >> LM75_CONF_##NAME##_POS )
+#define LM75_CONF_PUT(NAME, value)      ( ((value) << LM75_CONF_##NAME##_POS) & LM75_CONF_##NAME##_MASK )
+
+
+/* Sensor version depending on how the Temp register is read */
+#define LM75_VERSION_ENUM(ver, shift)   ver,
+typedef enum {
+    LM75_VERSIONS(LM75_VERSION_ENUM)
+    LM75_VERSION_COUNT
+} LM75_Version;
+
+/* Mask of the valid bits of a raw Temp value, 0 for an unknown version */
+#define LM75_VERSION_MASK_CASE(ver, shift)  case ver: return (uint16_t)(0xFFFFU << (shift));
+static inline uint16_t LM75_VersionMask(uint8_t ver)
+{
+    switch (ver)
+    {
+        LM75_VERSIONS(LM75_VERSION_MASK_CASE)
+        default: return 0;
+    }
+}
+
+/* Weight of the lowest valid raw bit as a power of two, 16 for an unknown version */
+#define LM75_VERSION_SHIFT_CASE(ver, shift) case ver: return (shift);
+static inline uint8_t LM75_VersionShift(uint8_t ver)
+{
+    switch (ver)
+    {
+        LM75_VERSIONS(LM75_VERSION_SHIFT_CASE)
+        default: return 16;
+    }
+}
+
+
+/* Copy of the writable registers, e.g. shadow.tos */
+#define LM75_REG_SHADOW_RO(type, field)
+#define LM75_REG_SHADOW_RW(type, field)     type field;
+#define LM75_REG_SHADOW(NAME, Name, field, ptr, size, type, access)     LM75_REG_SHADOW_##access(type, field)
+typedef struct {
+    LM75_REGISTERS(LM75_REG_SHADOW)
+} LM75_Shadow;
+
+
+/* Name of a register for traces, "?" for an unknown pointer value */
+#define LM75_REG_NAME_CASE(NAME, Name, field, ptr, size, type, access)  case (ptr): return #NAME;
+static inline const char *LM75_RegName(uint8_t ptr)
+{
+    switch (ptr)
+    {
+        LM75_REGISTERS(LM75_REG_NAME_CASE)
+        default: return "?";
+    }
+}
+
+
+/* Register value from its bytes in transmission order, and back */
+static inline uint16_t LM75_RegUnpack(const uint8_t *buf, uint8_t size)
+{
+    uint16_t value = 0;
+
+    for (uint8_t i = 0; i < size; i++)
+    {
+        value = (uint16_t)((value << 8) | buf[i]);
+    }
+
+    return value;
+}
+
+static inline void LM75_RegPack(uint8_t *buf, uint8_t size, uint16_t value)
+{
+    for (uint8_t i = size; i > 0; i--)
+    {
+        buf[i - 1] = (uint8_t)(value & 0xFF);
+        value >>= 8;
+    }
+}
+
+
+/*
+ * Typed accessors LM75_Read<Name> and, for RW registers, LM75_Write<Name>, expanded by lm75.h
+ * once struct LM75 is complete. Both keep the shadow copy in the LM75_Cold part up to date.
+ */
+#define LM75_REG_STORE_RO(dev, field, value)
+#define LM75_REG_STORE_RW(dev, field, value)    (dev)->cold->shadow.field = (value);
+
+#define LM75_REG_WRITER_RO(Name, field, ptr, size, type)
+#define LM75_REG_WRITER_RW(Name, field, ptr, size, type) \
+    static inline LM75_Status LM75_Write##Name(LM75 *dev, type value) \
+    { \
+        uint8_t buf[size]; \
+        LM75_RegPack(buf, (size), value); \
+        if (LM75_OK != LM75_WriteRegister(dev, (ptr), buf, (size))) \
+        { \
+            return LM75_ERROR; \
+        } \
+        LM75_REG_STORE_RW(dev, field, value) \
+        return LM75_OK; \
+    }
+
+#define LM75_REG_ACCESSORS(NAME, Name, field, ptr, size, type, access) \
+    static inline LM75_Status LM75_Read##Name(LM75 *dev, type *dest) \
+    { \
+        uint8_t buf[size]; \
+        if (LM75_OK != LM75_ReadRegister(dev, (ptr), buf, (size))) \
+        { \
+            return LM75_ERROR; \
+        } \
+        *dest = (type)LM75_RegUnpack(buf, (size)); \
+        LM75_REG_STORE_##access(dev, field, *dest) \
+        return LM75_OK; \
+    } \
+    LM75_REG_WRITER_##access(Name, field, ptr, size, type)
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
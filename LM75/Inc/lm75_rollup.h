@@ -0,0 +1,73 @@
+/*******************************************************
+ * File Name: lm75_rollup.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 multi-tier time-series rollups.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_ROLLUP__
+#define __LM75_ROLLUP__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Summary of the samples of one period, temperatures in 1/256 degree celsius */
+typedef struct {
+    /* Start of the period in LM75_TIMESTAMP() units */
+    uint32_t start;
+
+    /* Number of samples, min and max are only valid when not 0 */
+    uint32_t count;
+    int64_t sum;
+    int16_t min;
+    int16_t max;
+} LM75_RollupBucket;
+
+
+/* Ring of the last len periods of one tier, ring[head] is the period in progress */
+typedef struct {
+    LM75_RollupBucket *ring;
+    uint16_t len;
+    uint16_t head;
+
+    /* Buckets holding a period, up to len */
+    uint16_t filled;
+
+    /* Period length in LM75_TIMESTAMP() units, a multiple of the period of the tier below */
+    uint32_t period;
+} LM75_RollupTier;
+
+
+/*
+ * Cascading tiers, e.g. 1 s, 1 min and 1 h. Samples go to tier 0, each closed period
+ * is folded into the period in progress of the next tier. RAM is the rings given by the caller.
+ */
+typedef struct {
+    LM75_RollupTier *tiers;
+    uint8_t count;
+} LM75_Rollup;
+
+
+void LM75_Rollup_InitTier(LM75_RollupTier *tier, LM75_RollupBucket *ring, uint16_t len, uint32_t period);
+LM75_Status LM75_Rollup_Init(LM75_Rollup *rollup, LM75_RollupTier *tiers, uint8_t count, uint32_t now);
+void LM75_Rollup_Add(LM75_Rollup *rollup, int16_t temp_fixed, uint32_t now);
+void LM75_Rollup_Update(LM75_Rollup *rollup, const LM75 *dev, uint32_t now);
+LM75_Status LM75_Rollup_Get(const LM75_Rollup *rollup, uint8_t tier, uint16_t age, LM75_RollupBucket *dest);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
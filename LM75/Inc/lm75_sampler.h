@@ -0,0 +1,104 @@
+/*******************************************************
+ * File Name: lm75_sampler.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the timer triggered LM75 sampler.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_SAMPLER__
+#define __LM75_SAMPLER__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Sampling timer: a HAL timer, or a simulated timer (lm75_sim.h) in simulated builds */
+#ifdef LM75_USE_SIM
+typedef struct LM75_SimTimer LM75_Timer;
+#else
+typedef TIM_HandleTypeDef LM75_Timer;
+#endif
+
+
+/* Result of one sensor read launched by a timer trigger */
+typedef struct {
+    /* LM75_TIMESTAMP() captured when the timer interrupt was served */
+    uint32_t trigger_ts;
+
+    /* Timer counter value when the read was started, i.e. ticks since the update event */
+    uint32_t start_delay;
+
+    /* Temperature in degrees celsius */
+    float temp_c;
+
+    /* Result of the read */
+    LM75_Status status;
+} LM75_Sample;
+
+
+/* Structure storing the sampler state */
+typedef struct {
+    /* Timer generating the sampling period */
+    LM75_Timer *tim;
+
+    /* Sensors read on each trigger, all on the same bus */
+    LM75 *devs;
+    uint8_t count;
+
+    /* Latest sample of each sensor, count entries */
+    LM75_Sample *samples;
+
+    /* Index of the sensor being read, count when idle */
+    volatile uint8_t idx;
+
+    /* Timestamp of the current trigger */
+    uint32_t trigger_ts;
+
+    /* Number of triggers served and of fully completed sequences */
+    volatile uint32_t triggers;
+    volatile uint32_t completed;
+
+    /* Triggers dropped because the previous sequence was still running */
+    volatile uint32_t overruns;
+
+    /* Smallest and largest start delay of the first sensor, in timer ticks */
+    uint32_t jitter_min;
+    uint32_t jitter_max;
+} LM75_Sampler;
+
+
+LM75_Status LM75_Sampler_Init(LM75_Sampler *smp, LM75_Timer *htim, LM75 *devs, uint8_t count, LM75_Sample *samples);
+LM75_Status LM75_Sampler_Start(LM75_Sampler *smp);
+LM75_Status LM75_Sampler_Stop(LM75_Sampler *smp);
+uint32_t LM75_Sampler_GetJitter(const LM75_Sampler *smp);
+
+/* Call from HAL_TIM_PeriodElapsedCallback for the sampler timer, or when LM75_Sim_TimerElapsed is true */
+void LM75_Sampler_TimerCallback(LM75_Sampler *smp);
+
+#if defined(LM75_USE_SIM)
+/* Simulated reads complete before returning, no callback to route */
+#elif defined(LM75_USE_LL)
+/* Call from the I2C interrupt handler instead of LM75_IRQHandler */
+void LM75_Sampler_IRQHandler(LM75_Sampler *smp);
+#else
+/* Call from the HAL I2C callbacks instead of LM75_RxCpltCallback and LM75_ErrorCallback */
+void LM75_Sampler_RxCpltCallback(LM75_Sampler *smp);
+void LM75_Sampler_ErrorCallback(LM75_Sampler *smp);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
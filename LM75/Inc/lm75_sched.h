@@ -0,0 +1,89 @@
+/*******************************************************
+ * File Name: lm75_sched.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 wake scheduler.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_SCHED__
+#define __LM75_SCHED__
+
+
+#include "lm75.h"
+#include "lm75_health.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Maximum number of entries handled by LM75_Sched_Plan */
+#ifndef LM75_SCHED_MAX_ENTRIES
+#define LM75_SCHED_MAX_ENTRIES      16
+#endif
+
+
+/* Largest period multiplier of an unhealthy sensor, as a shift */
+#ifndef LM75_SCHED_MAX_BACKOFF
+#define LM75_SCHED_MAX_BACKOFF      4
+#endif
+
+
+/* Largest period accepted by LM75_Sched_Init, so the backed-off period stays comparable across counter wrap */
+#define LM75_SCHED_MAX_PERIOD       (0x7FFFFFFFUL >> LM75_SCHED_MAX_BACKOFF)
+
+
+/* Periodic read of one sensor, dev, period, tolerance and health are set by the caller */
+typedef struct {
+    /* Sensor to read */
+    LM75 *dev;
+
+    /* Nominal read period in LM75_TIMESTAMP() units, at most LM75_SCHED_MAX_PERIOD */
+    uint32_t period;
+
+    /* The read may be done this much before or after the nominal time, less than period / 2 */
+    uint32_t tolerance;
+
+    /* Nominal time of the next read */
+    uint32_t due;
+
+    /* Result of the last read */
+    LM75_Status status;
+
+    /* Optional health tracking, NULL if not used */
+    LM75_Health *health;
+
+    /* Period is doubled for each read while the sensor is unhealthy */
+    uint8_t backoff;
+} LM75_SchedEntry;
+
+
+/* Structure storing the scheduler state */
+typedef struct {
+    /* Scheduled reads */
+    LM75_SchedEntry *entries;
+    uint8_t count;
+
+    /* Number of wake-ups served and of sensor reads made */
+    uint32_t wakeups;
+    uint32_t reads;
+} LM75_Sched;
+
+
+LM75_Status LM75_Sched_Init(LM75_Sched *sch, LM75_SchedEntry *entries, uint8_t count, uint32_t now);
+uint32_t LM75_Sched_NextWake(const LM75_Sched *sch);
+LM75_Status LM75_Sched_Run(LM75_Sched *sch, uint32_t now);
+LM75_Status LM75_Sched_Plan(const LM75_Sched *sch, uint32_t horizon, uint32_t *wakeups, uint32_t *reads);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
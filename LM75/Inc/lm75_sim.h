@@ -0,0 +1,153 @@
+/*******************************************************
+ * File Name: lm75_sim.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the simulated LM75 buses and the host fleet runner.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_SIM__
+#define __LM75_SIM__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Largest number of worker threads of LM75_Sim_Run */
+#ifndef LM75_SIM_MAX_THREADS
+#define LM75_SIM_MAX_THREADS        64
+#endif
+
+
+/*
+ * Simulated sensor with a first order thermal model: the die temperature moves towards
+ * ambient + self heating with time constant tau_ms, plus a small noise on every conversion.
+ * A conversion ends every conv_us of bus time; Temp reads in between return the last one.
+ */
+typedef struct {
+    /* 7-bit address */
+    uint8_t addr;
+
+    /* Pointer register and register file, Temp holds the last conversion */
+    uint8_t ptr;
+    uint8_t conf;
+    uint16_t temp_reg;
+    uint16_t thyst;
+    uint16_t tos;
+
+    /* Die temperature, ambient and self heating in 1/256 degree celsius */
+    int32_t temp;
+    int32_t ambient;
+    int32_t heating;
+
+    /* Amplitude of the uniform conversion noise in 1/256 degree celsius */
+    uint16_t noise;
+
+    /* Thermal time constant */
+    uint32_t tau_ms;
+
+    /* Bus time of the last model update in microseconds */
+    uint32_t updated_us;
+
+    /* Conversion time, 100 ms by default, and bus time the last conversion ended */
+    uint32_t conv_us;
+    uint32_t converted_us;
+
+    /* Noise generator state, never 0 */
+    uint32_t seed;
+} LM75_SimDevice;
+
+
+/* Simulated I2C bus, used as LM75_Bus when built with LM75_USE_SIM */
+struct LM75_SimBus {
+    /* Sensors on the bus */
+    LM75_SimDevice *devs;
+    uint16_t count;
+
+    /* Bus clock, every bit advances the bus time */
+    uint32_t bus_hz;
+
+    /* Bus time in microseconds */
+    uint32_t now_us;
+
+    /* Bus time in milliseconds and the microseconds not yet counted in it, wraps like HAL_GetTick */
+    uint32_t now_ms;
+    uint16_t sub_ms_us;
+
+    /* Transfers made and transfers not acknowledged */
+    uint32_t transfers;
+    uint32_t nacks;
+
+    /* The host thread sleeps for the duration of every transfer, so threads sharing the bus wait for each other as on hardware */
+    bool realtime;
+};
+
+
+/* Simulated periodic timer, the sampler timer of simulated builds, counts bus time in microseconds */
+typedef struct LM75_SimTimer {
+    LM75_Bus *bus;
+    uint32_t period_us;
+
+    /* Bus time of the last update event */
+    uint32_t last_us;
+    bool running;
+} LM75_SimTimer;
+
+
+/* One unit of work of LM75_Sim_Run: read every sensor of a bus rounds times */
+typedef struct {
+    LM75_Bus *bus;
+    LM75 *sensors;
+    uint16_t count;
+    uint32_t rounds;
+
+    /* Results */
+    uint32_t reads;
+    uint32_t errors;
+} LM75_SimJob;
+
+
+/* Totals of LM75_Sim_Run */
+typedef struct {
+    uint64_t reads;
+    uint64_t errors;
+
+    /* Jobs run by a worker other than the one they were given to */
+    uint32_t stolen;
+
+    /* Host wall time of the run and successful reads per second of it */
+    uint64_t elapsed_us;
+    uint64_t reads_per_s;
+} LM75_SimReport;
+
+
+void LM75_Sim_InitDevice(LM75_SimDevice *sdev, uint8_t addr, float ambient_c, float heating_c, uint32_t tau_ms, uint32_t seed);
+void LM75_Sim_InitBus(LM75_Bus *bus, LM75_SimDevice *devs, uint16_t count, uint32_t bus_hz);
+LM75_Status LM75_Sim_Write(LM75_Bus *bus, uint8_t addr, uint8_t reg, const uint8_t *data, uint16_t size);
+LM75_Status LM75_Sim_Read(LM75_Bus *bus, uint8_t addr, uint8_t reg, uint8_t *dest, uint16_t size);
+LM75_Status LM75_Sim_Receive(LM75_Bus *bus, uint8_t addr, uint8_t *dest, uint16_t size);
+void LM75_Sim_Idle(LM75_Bus *bus, uint32_t us);
+void LM75_Sim_Nack(LM75_Bus *bus);
+void LM75_Sim_SetClock(LM75_Bus *bus);
+void LM75_Sim_InitTimer(LM75_SimTimer *tim, LM75_Bus *bus, uint32_t period_us);
+void LM75_Sim_TimerStart(LM75_SimTimer *tim);
+void LM75_Sim_TimerStop(LM75_SimTimer *tim);
+uint32_t LM75_Sim_TimerCounter(const LM75_SimTimer *tim);
+bool LM75_Sim_TimerElapsed(LM75_SimTimer *tim);
+LM75_Status LM75_Sim_Run(LM75_SimJob *jobs, uint32_t njobs, uint8_t threads, LM75_SimReport *report);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
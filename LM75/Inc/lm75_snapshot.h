@@ -0,0 +1,74 @@
+/*******************************************************
+ * File Name: lm75_snapshot.h
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Header file containing declarations of the LM75 multi-sensor snapshots.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#ifndef __LM75_SNAPSHOT__
+#define __LM75_SNAPSHOT__
+
+
+#include "lm75.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Maximum number of sensors in one snapshot */
+#ifndef LM75_SNAPSHOT_MAX_DEVS
+#define LM75_SNAPSHOT_MAX_DEVS      32
+#endif
+
+
+/* Raw values of all sensors collected during one scan */
+typedef struct {
+    /* Scan number, 0 while the snapshot is being written */
+    volatile uint32_t epoch;
+
+    /* LM75_TIMESTAMP() at the start and at the end of the scan */
+    uint32_t start_ts;
+    uint32_t end_ts;
+
+    /* Raw Temp register value of each sensor */
+    uint16_t raw[LM75_SNAPSHOT_MAX_DEVS];
+
+    /* Set when the sensor was read successfully */
+    bool ok[LM75_SNAPSHOT_MAX_DEVS];
+} LM75_Snapshot;
+
+
+/* Double buffered snapshots of a set of sensors */
+typedef struct {
+    /* Scanned sensors */
+    LM75 *devs;
+    uint8_t count;
+
+    /* Published and in progress snapshots */
+    LM75_Snapshot buf[2];
+
+    /* Index of the published snapshot */
+    volatile uint8_t front;
+
+    /* Epoch of the published snapshot, 0 until the first scan ends */
+    volatile uint32_t epoch;
+} LM75_SnapshotSet;
+
+
+LM75_Status LM75_Snapshot_Init(LM75_SnapshotSet *set, LM75 *devs, uint8_t count);
+LM75_Status LM75_Snapshot_Scan(LM75_SnapshotSet *set);
+LM75_Status LM75_Snapshot_Read(const LM75_SnapshotSet *set, LM75_Snapshot *dest);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -9,188 +9,836 @@
  *******************************************************/
 
 
-#include <math.h>
 #include <stdbool.h>
 
 
 #include "lm75.h"
+#include "lm75_energy.h"
 
 
-/* Pointers to registers */
-#define LM75_TEMP_REG       0x00
-#define LM75_CONF_REG       0x01
-#define LM75_THYST_REG      0x02
-#define LM75_TOS_REG        0x03
+#ifdef LM75_USE_SIM
+#include "lm75_sim.h"
+#endif
 
 
-/* Configuration register bits */
-#define SHUTDOWN            0x01
-#define CMP_MODE            0x00
-#define INT_MODE            0x20
-#define OS_ACT_LOW          0x00
-#define OS_ACT_HIGH         0x04
-#define ONE_FAULT           0x00
-#define TWO_FAULTS          0x08
-#define FOUR_FAULTS         0x10
-#define SIX_FAULTS          0x18
+/* Define LM75_FAULT_INJECTION to route every transfer through lm75_fault.h, for test builds only */
+#ifdef LM75_FAULT_INJECTION
+#include <string.h>
+#include "lm75_fault.h"
+#endif
 
 
-/* Register lengths */
-#define MAX_REG_SIZE        2
-#define MIN_REG_SIZE        1
+/* Default configuration written by LM75_Init */
+#define DEFAULT_CONF        LM75_CONF_ENCODE(LM75_FAULTS_2, LM75_OS_ACT_LOW, LM75_CMP_MODE, false)
 
 
 /* Maximum transmission time */
 #define TIMEOUT             500
 
 
+/* Maximum number of flag polls of a LL transfer step */
+#define LL_TIMEOUT_LOOPS    50000
+
+
+#ifdef LM75_FAULT_INJECTION
+
+/* Retries of a transfer after an injected arbitration loss, each once the other master freed the bus */
+#define ARB_RETRIES         3
+#define ARB_BUS_FREE_US     500
+
+/* Bus time of an injected NACK on a target: START, address byte and STOP at 100 kHz */
+#define NACK_US             110
+
+#endif
+
+
 /* Limits of Thyst and Tos register */
 #define MAX_TEMP           125
 #define MIN_TEMP           -55  
 
 
+/* Output formats of batch reads */
+#define BATCH_RAW           0
+#define BATCH_FIXED         1
+#define BATCH_FLOAT         2
+
+
 /* Result value of conversion error */
 #define CONV_ERR            -1000.0f
 
 
-static LM75_Status write_config(LM75 *dev, uint8_t *data);
-static LM75_Status read_config(LM75 *dev, uint8_t *dest);
-static LM75_Status write_temperature(LM75 *dev, uint8_t mem_addr, float temp);
-static LM75_Status read_temperature(LM75 *dev, uint8_t mem_addr, uint16_t *dest);
-static bool is_temperature_negative(uint16_t temp);
-static LM75_Status conv_neg_temp_from_raw(uint16_t raw_temp, LM75_Version ver, float *dest);
-static LM75_Status conv_pos_temp_from_raw(uint16_t raw_temp, LM75_Version ver, float *dest);
+static LM75_Status bus_write(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size);
+static LM75_Status bus_read_at(LM75_Bus *bus, uint8_t addr, uint8_t mem_addr, uint8_t *dest, uint16_t size);
+static LM75_Status bus_receive_at(LM75_Bus *bus, uint8_t addr, uint8_t *dest, uint16_t size);
+static LM75_Status bus_read(LM75 *dev, uint8_t mem_addr, uint8_t *dest, uint16_t size);
+static LM75_Status bus_receive(LM75 *dev, uint8_t *dest, uint16_t size);
+static LM75_Status bus_read_it(LM75 *dev, uint8_t mem_addr, uint8_t size);
+static void bus_abort_it(LM75 *dev);
+static void account_transfer(LM75 *dev, uint16_t bytes, uint8_t conditions);
+static LM75_Status write_reg(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size);
+static LM75_Status read_reg(LM75 *dev, uint8_t mem_addr, uint8_t *dest, uint16_t size);
+static void lock_bus(LM75 *dev);
+static void unlock_bus(LM75 *dev);
+static LM75_Status start_read_it(LM75 *dev, LM75_Callback cb, void *ctx);
+static void notify_waiter(LM75 *dev, LM75_Status status, void *ctx);
+static void finish_read_it(LM75 *dev, bool ok);
+static LM75_Status decode_temperature(LM75 *dev, uint16_t raw_temp);
+static void init_descriptor(LM75 *dev, LM75_Cold *cold, LM75_Bus *hi2c, LM75_BusLock *lock, LM75_Version ver, uint8_t addr);
+static bool is_config_valid(const LM75_Config *cfg);
+static LM75_Status read_batch(LM75 *devs, uint16_t count, uint8_t format, void *dest, LM75_Status *status);
+
+
+#ifdef LM75_FAULT_INJECTION
+
+static LM75_Status inject_write(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size);
+static LM75_Status inject_read(LM75 *dev, uint8_t mem_addr, uint8_t *dest, uint16_t size, bool cached);
+static LM75_Status inject_read_it(LM75 *dev, uint8_t mem_addr, uint8_t size);
+static LM75_FaultClass inject_fault(LM75 *dev, uint8_t mem_addr, bool write, bool blocking);
+static void inject_wait(LM75 *dev, uint32_t us, bool blocking);
+static void inject_nack(LM75 *dev, bool blocking);
+
+#define BUS_WRITE(dev, mem_addr, data, size)    inject_write(dev, mem_addr, data, size)
+#define BUS_READ(dev, mem_addr, dest, size)     inject_read(dev, mem_addr, dest, size, false)
+#define BUS_RECEIVE(dev, mem_addr, dest, size)  inject_read(dev, mem_addr, dest, size, true)
+#define BUS_READ_IT(dev, mem_addr, size)        inject_read_it(dev, mem_addr, size)
+
+/* Injected faults are decided per sensor, so the reads at a given bus and address go through the descriptor */
+#define BUS_READ_AT(dev, bus, addr, mem_addr, dest, size)   inject_read(dev, mem_addr, dest, size, false)
+#define BUS_RECEIVE_AT(dev, bus, addr, mem_addr, dest, size) inject_read(dev, mem_addr, dest, size, true)
+
+#else
+
+#define BUS_WRITE(dev, mem_addr, data, size)    bus_write(dev, mem_addr, data, size)
+#define BUS_READ(dev, mem_addr, dest, size)     bus_read(dev, mem_addr, dest, size)
+#define BUS_RECEIVE(dev, mem_addr, dest, size)  bus_receive(dev, dest, size)
+#define BUS_READ_IT(dev, mem_addr, size)        bus_read_it(dev, mem_addr, size)
 
+#define BUS_READ_AT(dev, bus, addr, mem_addr, dest, size)   bus_read_at(bus, addr, mem_addr, dest, size)
+#define BUS_RECEIVE_AT(dev, bus, addr, mem_addr, dest, size) bus_receive_at(bus, addr, dest, size)
 
-/* Write to configuration register */
-static LM75_Status write_config(LM75 *dev, uint8_t *data)
+#endif
+
+
+#if defined(LM75_USE_SIM)
+
+/* Write data to a register of a simulated sensor */
+static LM75_Status bus_write(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size)
+{
+    return LM75_Sim_Write(dev->i2c, dev->addr, mem_addr, data, size);
+}
+
+/* Read data from a register of a simulated sensor */
+static LM75_Status bus_read_at(LM75_Bus *bus, uint8_t addr, uint8_t mem_addr, uint8_t *dest, uint16_t size)
 {
-    if (HAL_OK != HAL_I2C_Mem_Write(dev->i2c, dev->addr, LM75_CONF_REG, I2C_MEMADD_SIZE_8BIT, data, MIN_REG_SIZE, TIMEOUT))
+    return LM75_Sim_Read(bus, addr, mem_addr, dest, size);
+}
+
+/* Read data from the register already selected by the pointer register */
+static LM75_Status bus_receive_at(LM75_Bus *bus, uint8_t addr, uint8_t *dest, uint16_t size)
+{
+    return LM75_Sim_Receive(bus, addr, dest, size);
+}
+
+/* Interrupt driven read, the simulated bus completes it at once */
+static LM75_Status bus_read_it(LM75 *dev, uint8_t mem_addr, uint8_t size)
+{
+    LM75_Status status;
+
+    dev->cold->it.reg = mem_addr;
+    dev->cold->it.len = size;
+    dev->cold->it.idx = 0;
+    dev->xfer = LM75_XFER_DATA;
+
+    if (dev->ptr == mem_addr)
     {
-        return LM75_ERROR;
+        status = bus_receive(dev, dev->cold->it.buf, size);
     }
+    else
+    {
+        status = bus_read(dev, mem_addr, dev->cold->it.buf, size);
+    }
+
+    dev->cold->it.idx = (LM75_OK == status) ? size : 0;
+    finish_read_it(dev, LM75_OK == status);
 
     return LM75_OK;
 }
 
-/* Read from the configuration register */
-static LM75_Status read_config(LM75 *dev, uint8_t *dest)
+/* Simulated reads end before bus_read_it returns, nothing to abort */
+static void bus_abort_it(LM75 *dev)
 {
+    (void)dev;
+}
+
+#elif defined(LM75_USE_LL)
+
+static bool ll_wait_flag(I2C_TypeDef *i2c, uint32_t (*is_active)(I2C_TypeDef *));
+static LM75_Status ll_end_transfer(I2C_TypeDef *i2c, bool ok);
+static void ll_disable_it(I2C_TypeDef *i2c);
+
 
-    if (HAL_OK != HAL_I2C_Mem_Read(dev->i2c, dev->addr, LM75_CONF_REG, I2C_MEMADD_SIZE_8BIT, dest, MIN_REG_SIZE, TIMEOUT))
+/* Poll a flag until it is set, give up on NACK or after LL_TIMEOUT_LOOPS polls */
+static bool ll_wait_flag(I2C_TypeDef *i2c, uint32_t (*is_active)(I2C_TypeDef *))
+{
+    uint32_t loops = LL_TIMEOUT_LOOPS;
+
+    while (!is_active(i2c))
     {
-        return LM75_ERROR;
+        if (LL_I2C_IsActiveFlag_NACK(i2c) || 0 == --loops)
+        {
+            return false;
+        }
     }
 
-    return LM75_OK;
+    return true;
 }
 
-/* Write to Tos or Thyst register */
-static LM75_Status write_temperature(LM75 *dev, uint8_t mem_addr, float temp)
+/*
+ * Wait for the STOP condition and clear the transfer flags. A step that timed out without a NACK
+ * gets no automatic STOP (SOFTEND, or AUTOEND before its last byte), so it is generated here;
+ * if the STOP never comes the peripheral is reset so the next transfer does not find it busy.
+ */
+static LM75_Status ll_end_transfer(I2C_TypeDef *i2c, bool ok)
 {
-    int8_t value[MAX_REG_SIZE] = {0};
+    uint32_t loops = LL_TIMEOUT_LOOPS;
+
+    if (!ok && !LL_I2C_IsActiveFlag_NACK(i2c))
+    {
+        LL_I2C_GenerateStopCondition(i2c);
+    }
+
+    while (!LL_I2C_IsActiveFlag_STOP(i2c))
+    {
+        if (0 == --loops)
+        {
+            /* Software reset: PE low clears the state machine and the flags */
+            LL_I2C_Disable(i2c);
+            while (LL_I2C_IsEnabled(i2c))
+            {
+            }
+            LL_I2C_Enable(i2c);
 
-    value[0] = temp;
+            return LM75_ERROR;
+        }
+    }
 
-    if ( fabs(temp - value[0]) >= 0.5f )
+    if (LL_I2C_IsActiveFlag_NACK(i2c))
     {
-        value[1] = 0x80;
+        LL_I2C_ClearFlag_NACK(i2c);
+        ok = false;
+    }
+
+    LL_I2C_ClearFlag_STOP(i2c);
+
+    return ok ? LM75_OK : LM75_ERROR;
+}
+
+/* Disable all interrupts used by the read state machine */
+static void ll_disable_it(I2C_TypeDef *i2c)
+{
+    LL_I2C_DisableIT_TX(i2c);
+    LL_I2C_DisableIT_RX(i2c);
+    LL_I2C_DisableIT_TC(i2c);
+    LL_I2C_DisableIT_STOP(i2c);
+    LL_I2C_DisableIT_NACK(i2c);
+    LL_I2C_DisableIT_ERR(i2c);
+}
+
+/* Write the register pointer followed by data, ended with an automatic STOP */
+static LM75_Status bus_write(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size)
+{
+    bool ok = true;
+
+    LL_I2C_HandleTransfer(dev->i2c, dev->addr, LL_I2C_ADDRSLAVE_7BIT, size + 1, LL_I2C_MODE_AUTOEND, LL_I2C_GENERATE_START_WRITE);
+
+    if (ll_wait_flag(dev->i2c, LL_I2C_IsActiveFlag_TXIS))
+    {
+        LL_I2C_TransmitData8(dev->i2c, mem_addr);
+
+        for (uint16_t i = 0; i < size; i++)
+        {
+            if (!ll_wait_flag(dev->i2c, LL_I2C_IsActiveFlag_TXIS))
+            {
+                ok = false;
+                break;
+            }
+
+            LL_I2C_TransmitData8(dev->i2c, data[i]);
+        }
     }
     else
     {
-        value[1] = 0x00;
+        ok = false;
+    }
+
+    return ll_end_transfer(dev->i2c, ok);
+}
+
+/* Write the register pointer, then read data after a repeated START */
+static LM75_Status bus_read_at(LM75_Bus *bus, uint8_t addr, uint8_t mem_addr, uint8_t *dest, uint16_t size)
+{
+    LL_I2C_HandleTransfer(bus, addr, LL_I2C_ADDRSLAVE_7BIT, 1, LL_I2C_MODE_SOFTEND, LL_I2C_GENERATE_START_WRITE);
+
+    if (!ll_wait_flag(bus, LL_I2C_IsActiveFlag_TXIS))
+    {
+        return ll_end_transfer(bus, false);
+    }
+
+    LL_I2C_TransmitData8(bus, mem_addr);
+
+    if (!ll_wait_flag(bus, LL_I2C_IsActiveFlag_TC))
+    {
+        return ll_end_transfer(bus, false);
+    }
+
+    LL_I2C_HandleTransfer(bus, addr, LL_I2C_ADDRSLAVE_7BIT, size, LL_I2C_MODE_AUTOEND, LL_I2C_GENERATE_START_READ);
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (!ll_wait_flag(bus, LL_I2C_IsActiveFlag_RXNE))
+        {
+            return ll_end_transfer(bus, false);
+        }
+
+        dest[i] = LL_I2C_ReceiveData8(bus);
+    }
+
+    return ll_end_transfer(bus, true);
+}
+
+/* Read data from the register already selected by the pointer register */
+static LM75_Status bus_receive_at(LM75_Bus *bus, uint8_t addr, uint8_t *dest, uint16_t size)
+{
+    LL_I2C_HandleTransfer(bus, addr, LL_I2C_ADDRSLAVE_7BIT, size, LL_I2C_MODE_AUTOEND, LL_I2C_GENERATE_START_READ);
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (!ll_wait_flag(bus, LL_I2C_IsActiveFlag_RXNE))
+        {
+            return ll_end_transfer(bus, false);
+        }
+
+        dest[i] = LL_I2C_ReceiveData8(bus);
     }
-    
-    if (HAL_OK != HAL_I2C_Mem_Write(dev->i2c, dev->addr, mem_addr, I2C_MEMADD_SIZE_8BIT, (uint8_t*)value, MAX_REG_SIZE, TIMEOUT))
+
+    return ll_end_transfer(bus, true);
+}
+
+/* Start an interrupt driven read of 1 or 2 bytes, progress is made in LM75_IRQHandler */
+static LM75_Status bus_read_it(LM75 *dev, uint8_t mem_addr, uint8_t size)
+{
+    /* Another sensor of the bus is being read, as HAL_BUSY on the HAL backend */
+    if (LL_I2C_IsActiveFlag_BUSY(dev->i2c))
     {
         return LM75_ERROR;
     }
 
+    dev->cold->it.reg = mem_addr;
+    dev->cold->it.len = size;
+    dev->cold->it.idx = 0;
+    dev->xfer = (dev->ptr == mem_addr) ? LM75_XFER_DATA : LM75_XFER_PTR;
+
+    LL_I2C_EnableIT_TX(dev->i2c);
+    LL_I2C_EnableIT_RX(dev->i2c);
+    LL_I2C_EnableIT_TC(dev->i2c);
+    LL_I2C_EnableIT_STOP(dev->i2c);
+    LL_I2C_EnableIT_NACK(dev->i2c);
+    LL_I2C_EnableIT_ERR(dev->i2c);
+
+    if (LM75_XFER_DATA == dev->xfer)
+    {
+        /* Pointer register already selects the register, skip the pointer byte */
+        LL_I2C_HandleTransfer(dev->i2c, dev->addr, LL_I2C_ADDRSLAVE_7BIT, size, LL_I2C_MODE_AUTOEND, LL_I2C_GENERATE_START_READ);
+    }
+    else
+    {
+        LL_I2C_HandleTransfer(dev->i2c, dev->addr, LL_I2C_ADDRSLAVE_7BIT, 1, LL_I2C_MODE_SOFTEND, LL_I2C_GENERATE_START_WRITE);
+    }
+
     return LM75_OK;
 }
 
-/* Read from Temp, Tos or Thyst register */
-static LM75_Status read_temperature(LM75 *dev, uint8_t mem_addr, uint16_t *dest)
+/* Stop an interrupt driven read: no further interrupt, STOP on the bus (see ll_end_transfer) and its flags cleared */
+static void bus_abort_it(LM75 *dev)
 {
-    uint8_t temp_data[MAX_REG_SIZE] = {0};
+    ll_disable_it(dev->i2c);
+    (void)ll_end_transfer(dev->i2c, false);
+}
+
+#else
 
-    if (HAL_OK != HAL_I2C_Mem_Read(dev->i2c, dev->addr, mem_addr, I2C_MEMADD_SIZE_8BIT, temp_data, MAX_REG_SIZE, TIMEOUT))
+/* Write data to the register selected by mem_addr */
+static LM75_Status bus_write(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size)
+{
+    if (HAL_OK != HAL_I2C_Mem_Write(dev->i2c, dev->addr, mem_addr, I2C_MEMADD_SIZE_8BIT, data, size, TIMEOUT))
     {
         return LM75_ERROR;
     }
 
-    *dest = (temp_data[0] << 8) | temp_data[1];
+    return LM75_OK;
+}
+
+/* Read data from the register selected by mem_addr */
+static LM75_Status bus_read_at(LM75_Bus *bus, uint8_t addr, uint8_t mem_addr, uint8_t *dest, uint16_t size)
+{
+    if (HAL_OK != HAL_I2C_Mem_Read(bus, addr, mem_addr, I2C_MEMADD_SIZE_8BIT, dest, size, TIMEOUT))
+    {
+        return LM75_ERROR;
+    }
 
     return LM75_OK;
 }
 
-/* Check if the value is negative */
-static bool is_temperature_negative(uint16_t temp)
+/* Read data from the register already selected by the pointer register */
+static LM75_Status bus_receive_at(LM75_Bus *bus, uint8_t addr, uint8_t *dest, uint16_t size)
 {
-    if (temp & 0x8000)
+    if (HAL_OK != HAL_I2C_Master_Receive(bus, addr, dest, size, TIMEOUT))
     {
-        return true;
+        return LM75_ERROR;
     }
-    
-    return false;
+
+    return LM75_OK;
 }
 
-/* Convert negative temperature from raw register value */
-static LM75_Status conv_neg_temp_from_raw(uint16_t raw_temp, LM75_Version ver, float *dest)
+/* Start an interrupt driven read, completion is reported through LM75_RxCpltCallback */
+static LM75_Status bus_read_it(LM75 *dev, uint8_t mem_addr, uint8_t size)
 {
-    raw_temp = ~raw_temp;
+    HAL_StatusTypeDef status;
 
-    if (LM75_9BIT == ver)
+    dev->cold->it.reg = mem_addr;
+    dev->cold->it.len = size;
+    dev->cold->it.idx = 0;
+    dev->xfer = LM75_XFER_DATA;
+
+    if (dev->ptr == mem_addr)
     {
-        raw_temp = (raw_temp >> 7) + 1; // 2 complement
-        *dest = -(0.5f * raw_temp); 
+        status = HAL_I2C_Master_Receive_IT(dev->i2c, dev->addr, dev->cold->it.buf, size);
     }
-    else if (LM75_11BIT == ver)
+    else
     {
-        raw_temp = (raw_temp >> 5) + 1; // 2 complement
-        *dest = -(0.125f * raw_temp);
+        status = HAL_I2C_Mem_Read_IT(dev->i2c, dev->addr, mem_addr, I2C_MEMADD_SIZE_8BIT, dev->cold->it.buf, size);
     }
-    else
+
+    if (HAL_OK != status)
     {
+        dev->xfer = LM75_XFER_ERROR;
         return LM75_ERROR;
     }
 
     return LM75_OK;
 }
 
-/* Convert positive temperature from raw register value */
-static LM75_Status conv_pos_temp_from_raw(uint16_t raw_temp, LM75_Version ver, float *dest)
+/* Stop an interrupt driven read, its completion callbacks are not called afterwards */
+static void bus_abort_it(LM75 *dev)
 {
-    if (LM75_9BIT == ver)
+    if (HAL_OK != HAL_I2C_Master_Abort_IT(dev->i2c, dev->addr))
     {
-        *dest = ( 0.5f * (raw_temp >> 7) );
+        /* Some HAL versions only abort plain master transfers, not memory reads: reset the peripheral */
+        (void)HAL_I2C_DeInit(dev->i2c);
+        (void)HAL_I2C_Init(dev->i2c);
     }
-    else if (LM75_11BIT == ver)
+}
+
+#endif
+
+/* Read data from a register of the sensor */
+static LM75_Status bus_read(LM75 *dev, uint8_t mem_addr, uint8_t *dest, uint16_t size)
+{
+    return bus_read_at(dev->i2c, dev->addr, mem_addr, dest, size);
+}
+
+/* Read data from the register of the sensor already selected by the pointer register */
+static LM75_Status bus_receive(LM75 *dev, uint8_t *dest, uint16_t size)
+{
+    return bus_receive_at(dev->i2c, dev->addr, dest, size);
+}
+
+/* Decode the received buffer of an interrupt driven read and release the sensor */
+static void finish_read_it(LM75 *dev, bool ok)
+{
+    dev->ptr = ok ? dev->cold->it.reg : LM75_PTR_UNKNOWN;
+
+#ifdef LM75_FAULT_INJECTION
+    if (ok && dev->cold->it.corrupt)
+    {
+        LM75_Fault_Corrupt(dev->cold->it.buf, dev->cold->it.len);
+    }
+#endif
+
+    if (ok && LM75_TEMP_REG == dev->cold->it.reg && LM75_TEMP_REG_SIZE == dev->cold->it.len)
+    {
+        ok = (LM75_OK == decode_temperature(dev, LM75_RegUnpack(dev->cold->it.buf, LM75_TEMP_REG_SIZE)));
+    }
+
+    dev->xfer = ok ? LM75_XFER_DONE : LM75_XFER_ERROR;
+
+    if (NULL != dev->cold->it.cb)
     {
-        *dest = ( 0.125f * (raw_temp >> 5) );
+        dev->cold->it.cb(dev, ok ? LM75_OK : LM75_ERROR, dev->cold->it.cb_ctx);
+    }
+}
+
+/* Count a transfer in the energy accounting of the sensor, if any */
+static void account_transfer(LM75 *dev, uint16_t bytes, uint8_t conditions)
+{
+    if (NULL != dev->cold->energy)
+    {
+        LM75_Energy_OnTransfer(dev->cold->energy, bytes, conditions);
+    }
+}
+
+/* Take the bus lock of the sensor, if any */
+static void lock_bus(LM75 *dev)
+{
+    if (NULL != dev->cold->lock)
+    {
+        LM75_OS_Lock(dev->cold->lock);
+    }
+}
+
+/* Release the bus lock of the sensor, if any */
+static void unlock_bus(LM75 *dev)
+{
+    if (NULL != dev->cold->lock)
+    {
+        LM75_OS_Unlock(dev->cold->lock);
+    }
+}
+
+/* Start an interrupt driven Temp read, the caller holds the bus lock if the sensor has one */
+static LM75_Status start_read_it(LM75 *dev, LM75_Callback cb, void *ctx)
+{
+    /* The start may already end the read, so the transfer shape is taken from the pointer before it */
+    bool cached = (LM75_TEMP_REG == dev->ptr);
+    LM75_Status status;
+
+    if (LM75_XFER_PTR == dev->xfer || LM75_XFER_DATA == dev->xfer)
+    {
+        return LM75_ERROR;
+    }
+
+    dev->cold->it.cb = cb;
+    dev->cold->it.cb_ctx = ctx;
+
+    status = BUS_READ_IT(dev, LM75_TEMP_REG, LM75_TEMP_REG_SIZE);
+
+    /* A start refused by the bus never reached it */
+    if (LM75_OK == status)
+    {
+        account_transfer(dev, LM75_TEMP_REG_SIZE + (cached ? 1 : 3), cached ? 2 : 3);
+    }
+
+    return status;
+}
+
+/* Completion callback of LM75_GetTemperature_Wait */
+static void notify_waiter(LM75 *dev, LM75_Status status, void *ctx)
+{
+    (void)dev;
+    (void)status;
+
+    LM75_OS_Notify((LM75_OS_Waiter *)ctx);
+}
+
+/* Write a register and remember it as the one selected by the pointer register */
+static LM75_Status write_reg(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size)
+{
+    LM75_Status status;
+
+    lock_bus(dev);
+
+    /* START, address, pointer, data, STOP */
+    account_transfer(dev, size + 2, 2);
+    status = BUS_WRITE(dev, mem_addr, data, size);
+    dev->ptr = (LM75_OK == status) ? mem_addr : LM75_PTR_UNKNOWN;
+
+    unlock_bus(dev);
+
+    return status;
+}
+
+/* Read a register, the pointer byte is skipped when the register is already selected */
+static LM75_Status read_reg(LM75 *dev, uint8_t mem_addr, uint8_t *dest, uint16_t size)
+{
+    LM75_Status status;
+
+    lock_bus(dev);
+
+    if (dev->ptr == mem_addr)
+    {
+        /* START, address, data, STOP */
+        account_transfer(dev, size + 1, 2);
+        status = BUS_RECEIVE(dev, mem_addr, dest, size);
     }
     else
     {
+        /* START, address, pointer, repeated START, address, data, STOP */
+        account_transfer(dev, size + 3, 3);
+        status = BUS_READ(dev, mem_addr, dest, size);
+    }
+
+    dev->ptr = (LM75_OK == status) ? mem_addr : LM75_PTR_UNKNOWN;
+
+    unlock_bus(dev);
+
+    return status;
+}
+
+#ifdef LM75_FAULT_INJECTION
+
+/*
+ * Let time pass as on a real bus: the simulated clock advances, a target waits unless blocking is false.
+ * The interrupt driven path passes false, it may run from a completion in interrupt context where
+ * HAL_Delay never returns, so on a target its faults end at once.
+ */
+static void inject_wait(LM75 *dev, uint32_t us, bool blocking)
+{
+#ifdef LM75_USE_SIM
+    (void)blocking;
+    LM75_Sim_Idle(dev->i2c, us);
+#else
+    (void)dev;
+
+    if (blocking)
+    {
+        HAL_Delay((us + 999U) / 1000U);
+    }
+#endif
+}
+
+/* Spend the bus time of an address byte not acknowledged, a NACK is not free */
+static void inject_nack(LM75 *dev, bool blocking)
+{
+#ifdef LM75_USE_SIM
+    (void)blocking;
+    LM75_Sim_Nack(dev->i2c);
+#else
+    inject_wait(dev, NACK_US, blocking);
+#endif
+}
+
+/* Decide the fault of a transfer, an arbitration loss is retried once the bus is free */
+static LM75_FaultClass inject_fault(LM75 *dev, uint8_t mem_addr, bool write, bool blocking)
+{
+    LM75_FaultClass fault = LM75_Fault_Inject(dev->addr >> 1, mem_addr, write);
+
+    for (uint8_t i = 0; i < ARB_RETRIES && LM75_FAULT_ARB_LOST == fault; i++)
+    {
+        inject_wait(dev, ARB_BUS_FREE_US, blocking);
+        fault = LM75_Fault_Inject(dev->addr >> 1, mem_addr, write);
+    }
+
+    return fault;
+}
+
+/* Write a register unless a fault is injected, a corrupted write reaches the sensor with one bit flipped */
+static LM75_Status inject_write(LM75 *dev, uint8_t mem_addr, uint8_t *data, uint16_t size)
+{
+    uint8_t sent[LM75_REG_MAX_SIZE];
+
+    switch (inject_fault(dev, mem_addr, true, true))
+    {
+        case LM75_FAULT_NONE:
+            return bus_write(dev, mem_addr, data, size);
+
+        case LM75_FAULT_CORRUPT:
+            if (size > sizeof(sent))
+            {
+                return LM75_ERROR;
+            }
+
+            memcpy(sent, data, size);
+            LM75_Fault_Corrupt(sent, size);
+
+            return bus_write(dev, mem_addr, sent, size);
+
+        case LM75_FAULT_TIMEOUT:
+            inject_wait(dev, TIMEOUT * 1000U, true);
+            return LM75_ERROR;
+
+        case LM75_FAULT_NACK:
+            inject_nack(dev, true);
+            return LM75_ERROR;
+
+        default:
+            return LM75_ERROR;
+    }
+}
+
+/* Read a register unless a fault is injected, a corrupted read returns with one bit flipped */
+static LM75_Status inject_read(LM75 *dev, uint8_t mem_addr, uint8_t *dest, uint16_t size, bool cached)
+{
+    LM75_FaultClass fault = inject_fault(dev, mem_addr, false, true);
+    LM75_Status status;
+
+    if (LM75_FAULT_TIMEOUT == fault)
+    {
+        inject_wait(dev, TIMEOUT * 1000U, true);
         return LM75_ERROR;
     }
 
+    if (LM75_FAULT_NACK == fault)
+    {
+        inject_nack(dev, true);
+    }
+
+    if (LM75_FAULT_NONE != fault && LM75_FAULT_CORRUPT != fault)
+    {
+        return LM75_ERROR;
+    }
+
+    status = cached ? bus_receive(dev, dest, size) : bus_read(dev, mem_addr, dest, size);
+
+    if (LM75_OK == status && LM75_FAULT_CORRUPT == fault)
+    {
+        LM75_Fault_Corrupt(dest, size);
+    }
+
+    return status;
+}
+
+/* Start an interrupt driven read unless a fault is injected, a failed read ends through the usual completion */
+static LM75_Status inject_read_it(LM75 *dev, uint8_t mem_addr, uint8_t size)
+{
+    LM75_FaultClass fault = inject_fault(dev, mem_addr, false, false);
+
+    dev->cold->it.corrupt = (LM75_FAULT_CORRUPT == fault);
+
+    if (LM75_FAULT_NONE == fault || LM75_FAULT_CORRUPT == fault)
+    {
+        return bus_read_it(dev, mem_addr, size);
+    }
+
+    dev->cold->it.reg = mem_addr;
+    dev->cold->it.len = size;
+    dev->cold->it.idx = 0;
+    dev->xfer = LM75_XFER_DATA;
+
+    if (LM75_FAULT_TIMEOUT == fault)
+    {
+#ifdef LM75_USE_SIM
+        /* Simulated reads end before returning, this one after the driver timeout */
+        inject_wait(dev, TIMEOUT * 1000U, false);
+        finish_read_it(dev, false);
+#endif
+        /* On a target no interrupt ends the read, the caller's timeout aborts it */
+        return LM75_OK;
+    }
+
+    if (LM75_FAULT_NACK == fault)
+    {
+        inject_nack(dev, false);
+    }
+
+    finish_read_it(dev, false);
+
     return LM75_OK;
 }
 
+#endif
 
-/* Initialisation of a new sensor */
-LM75_Status LM75_Init(LM75 *dev, I2C_HandleTypeDef *hi2c, LM75_Version ver, uint8_t addr, float low_lim, float upp_lim)
+/* Check that every field of the configuration holds one of its enum values */
+static bool is_config_valid(const LM75_Config *cfg)
 {
-    /* Configure the sensor */
-    uint8_t cfg_reg_value = ( TWO_FAULTS | OS_ACT_LOW | CMP_MODE );
+    if (cfg->faults != LM75_FAULTS_1 && cfg->faults != LM75_FAULTS_2 &&
+        cfg->faults != LM75_FAULTS_4 && cfg->faults != LM75_FAULTS_6)
+    {
+        return false;
+    }
 
-    /* Set struct parameters */
+    if (cfg->polarity != LM75_OS_ACT_LOW && cfg->polarity != LM75_OS_ACT_HIGH)
+    {
+        return false;
+    }
+
+    if (cfg->mode != LM75_CMP_MODE && cfg->mode != LM75_INT_MODE)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/* Read the Temp register of each sensor into dest[i] in the given format, without touching temp_c */
+static LM75_Status read_batch(LM75 *devs, uint16_t count, uint8_t format, void *dest, LM75_Status *status)
+{
+    LM75_Status result = LM75_OK;
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint16_t raw_temp = 0;
+
+        status[i] = LM75_ReadTemp(&devs[i], &raw_temp);
+
+        if (LM75_OK == status[i])
+        {
+            if (BATCH_RAW == format)
+            {
+                ((uint16_t *)dest)[i] = raw_temp;
+            }
+            else if (BATCH_FIXED == format)
+            {
+                status[i] = LM75_ConvertRawFixed(raw_temp, devs[i].ver, &((int16_t *)dest)[i]);
+            }
+            else
+            {
+                status[i] = LM75_ConvertRaw(raw_temp, devs[i].ver, &((float *)dest)[i]);
+            }
+        }
+
+        if (LM75_OK != status[i])
+        {
+            result = LM75_ERROR;
+        }
+    }
+
+    return result;
+}
+
+/* Convert a raw Temp register value and store it in the sensor structure */
+static LM75_Status decode_temperature(LM75 *dev, uint16_t raw_temp)
+{
+    dev->temp_raw = raw_temp;
+
+    if (LM75_OK != LM75_ConvertRaw(raw_temp, dev->ver, &(dev->temp_c)))
+    {
+        dev->temp_c = CONV_ERR;
+        return LM75_ERROR;
+    }
+
+    return LM75_OK;
+}
+
+/* Set the descriptor fields to their initial state, no bus access. Energy accounting is attached after Init, it needs the cold block */
+static void init_descriptor(LM75 *dev, LM75_Cold *cold, LM75_Bus *hi2c, LM75_BusLock *lock, LM75_Version ver, uint8_t addr)
+{
     dev->i2c = hi2c;
     dev->ver = ver;
     dev->addr = (addr << 1);
-    dev->thyst_c = 0.0f;
-    dev->tos_c = 0.0f;
+    dev->cold = cold;
+    dev->cold->lock = lock;
+    dev->cold->shadow.conf = 0;
+    dev->cold->shadow.thyst = 0;
+    dev->cold->shadow.tos = 0;
+    dev->ptr = LM75_PTR_UNKNOWN;
+    dev->cold->thyst_c = 0.0f;
+    dev->cold->tos_c = 0.0f;
     dev->temp_c = 0.0f;
+    dev->temp_raw = 0;
+    dev->xfer = LM75_XFER_IDLE;
+    dev->cold->it.cb = NULL;
+    dev->cold->it.cb_ctx = NULL;
+    dev->cold->energy = NULL;
+}
+
+
+/* Initialisation of a new sensor, lock is the lock of its bus (NULL if none) and is held by every transfer from here on */
+LM75_Status LM75_Init(LM75 *dev, LM75_Cold *cold, LM75_Bus *hi2c, LM75_BusLock *lock, LM75_Version ver, uint8_t addr, float low_lim, float upp_lim)
+{
+    /* Configure the sensor */
+    uint8_t cfg_reg_value = DEFAULT_CONF;
+
+    init_descriptor(dev, cold, hi2c, lock, ver, addr);
 
     /* TOS value must be greater than THYST */
     if (low_lim >= upp_lim)
@@ -199,10 +847,10 @@ LM75_Status LM75_Init(LM75 *dev, I2C_HandleTypeDef *hi2c, LM75_Version ver, uint
     }
 
     /* Set Conf register value */
-    if (LM75_OK != write_config(dev, &cfg_reg_value))
+    if (LM75_OK != LM75_WriteConf(dev, cfg_reg_value))
     {
         return LM75_ERROR;
-    }   
+    }
 
     /* Set Thyst register value */
     if (LM75_OK != LM75_SetHysteresis(dev, low_lim))
@@ -219,6 +867,19 @@ LM75_Status LM75_Init(LM75 *dev, I2C_HandleTypeDef *hi2c, LM75_Version ver, uint
     return LM75_OK;
 }
 
+/* Initialisation with pre-encoded Thyst and Tos register values (see LM75_LIMIT_ENCODE), nothing to encode at run time */
+LM75_Status LM75_InitRaw(LM75 *dev, LM75_Cold *cold, LM75_Bus *hi2c, LM75_BusLock *lock, LM75_Version ver, uint8_t addr, uint16_t thyst_raw, uint16_t tos_raw)
+{
+    init_descriptor(dev, cold, hi2c, lock, ver, addr);
+
+    if (LM75_OK != LM75_WriteConf(dev, DEFAULT_CONF))
+    {
+        return LM75_ERROR;
+    }
+
+    return LM75_SetLimitsRaw(dev, thyst_raw, tos_raw);
+}
+
 /* Set the limit at which the O.S. pin will no longer be driven */
 LM75_Status LM75_SetHysteresis(LM75 *dev, float low_lim)
 {
@@ -227,12 +888,12 @@ LM75_Status LM75_SetHysteresis(LM75 *dev, float low_lim)
         return LM75_ERROR;
     }
 
-    if (LM75_OK != write_temperature(dev, LM75_THYST_REG, low_lim))
+    if (LM75_OK != LM75_WriteThyst(dev, LM75_LIMIT_ENCODE(low_lim)))
     {
         return LM75_ERROR;
     }
 
-    dev->thyst_c = low_lim;
+    dev->cold->thyst_c = low_lim;
 
     return LM75_OK;
 }
@@ -245,93 +906,401 @@ LM75_Status LM75_SetOverTemperatureShutdown(LM75 *dev, float upp_lim)
         return LM75_ERROR;
     }
 
-    if (LM75_OK != write_temperature(dev, LM75_TOS_REG, upp_lim))
+    if (LM75_OK != LM75_WriteTos(dev, LM75_LIMIT_ENCODE(upp_lim)))
     {
         return LM75_ERROR;
     }
 
-    dev->tos_c = upp_lim;
+    dev->cold->tos_c = upp_lim;
 
     return LM75_OK;  
 }
 
+/* Convert a raw register value to signed fixed point in 1/256 degree celsius, unused bits cleared */
+LM75_Status LM75_ConvertRawFixed(uint16_t raw_temp, LM75_Version ver, int16_t *dest)
+{
+    uint16_t mask = LM75_VersionMask(ver);
+
+    if (0 == mask)
+    {
+        return LM75_ERROR;
+    }
+
+    *dest = (int16_t)(raw_temp & mask);
+
+    return LM75_OK;
+}
+
+/* Read count sensors into contiguous raw Temp register values, status[i] holds the result of each read */
+LM75_Status LM75_ReadBatchRaw(LM75 *devs, uint16_t count, uint16_t *dest, LM75_Status *status)
+{
+    return read_batch(devs, count, BATCH_RAW, dest, status);
+}
+
+/* Read count sensors into contiguous fixed point values in 1/256 degree celsius */
+LM75_Status LM75_ReadBatchFixed(LM75 *devs, uint16_t count, int16_t *dest, LM75_Status *status)
+{
+    return read_batch(devs, count, BATCH_FIXED, dest, status);
+}
+
+/* Read count sensors into contiguous temperatures in degrees celsius */
+LM75_Status LM75_ReadBatchFloat(LM75 *devs, uint16_t count, float *dest, LM75_Status *status)
+{
+    return read_batch(devs, count, BATCH_FLOAT, dest, status);
+}
+
+/* Set Thyst and Tos from pre-encoded register values, see LM75_LIMIT_ENCODE */
+LM75_Status LM75_SetLimitsRaw(LM75 *dev, uint16_t thyst_raw, uint16_t tos_raw)
+{
+    if ((int16_t)thyst_raw >= (int16_t)tos_raw ||
+        (int16_t)thyst_raw < (int16_t)LM75_LIMIT_ENCODE(MIN_TEMP) ||
+        (int16_t)tos_raw > (int16_t)LM75_LIMIT_ENCODE(MAX_TEMP))
+    {
+        return LM75_ERROR;
+    }
+
+    /* Limits always have the 9-bit layout, whatever the Temp resolution of the sensor */
+    if (LM75_OK != LM75_WriteThyst(dev, thyst_raw) ||
+        LM75_OK != LM75_ConvertRaw(thyst_raw, LM75_9BIT, &(dev->cold->thyst_c)))
+    {
+        return LM75_ERROR;
+    }
+
+    if (LM75_OK != LM75_WriteTos(dev, tos_raw) ||
+        LM75_OK != LM75_ConvertRaw(tos_raw, LM75_9BIT, &(dev->cold->tos_c)))
+    {
+        return LM75_ERROR;
+    }
+
+    return LM75_OK;
+}
+
 /* Get temperature value from sensor */
 LM75_Status LM75_GetTemperature(LM75 *dev)
 {
     uint16_t raw_temp = 0;
 
-    if (LM75_OK != read_temperature(dev, LM75_TEMP_REG, &raw_temp))
+    if (LM75_OK != LM75_ReadTemp(dev, &raw_temp))
     {
         return LM75_ERROR;
     }
 
-    if (is_temperature_negative(raw_temp))
+    return decode_temperature(dev, raw_temp);
+}
+
+/*
+ * Get the temperature of the sensor at bus and addr (8-bit, shifted), lock and ver being the ones it was
+ * initialised with. Meant for constant arguments such as the fleet table's: the transfer takes its bus,
+ * address byte, pointer byte and conversion from them instead of loading them from the descriptor.
+ */
+LM75_Status LM75_GetTemperatureAt(LM75 *dev, LM75_Bus *bus, LM75_BusLock *lock, uint8_t addr, LM75_Version ver)
+{
+    uint8_t buf[LM75_TEMP_REG_SIZE];
+    LM75_Status status;
+
+    (void)bus;
+    (void)addr;
+
+    if (NULL != lock)
+    {
+        LM75_OS_Lock(lock);
+    }
+
+    if (LM75_TEMP_REG == dev->ptr)
     {
-        if (LM75_OK != conv_neg_temp_from_raw(raw_temp, dev->ver, &(dev->temp_c)))
-        {
-            dev->temp_c = CONV_ERR;
-            return LM75_ERROR;
-        }
+        account_transfer(dev, LM75_TEMP_REG_SIZE + 1, 2);
+        status = BUS_RECEIVE_AT(dev, bus, addr, LM75_TEMP_REG, buf, LM75_TEMP_REG_SIZE);
     }
     else
     {
-        if (LM75_OK != conv_pos_temp_from_raw(raw_temp, dev->ver, &(dev->temp_c)))
-        {
-            dev->temp_c = CONV_ERR;
-            return LM75_ERROR;
-        }
+        account_transfer(dev, LM75_TEMP_REG_SIZE + 3, 3);
+        status = BUS_READ_AT(dev, bus, addr, LM75_TEMP_REG, buf, LM75_TEMP_REG_SIZE);
+    }
+
+    dev->ptr = (LM75_OK == status) ? LM75_TEMP_REG : LM75_PTR_UNKNOWN;
+
+    if (NULL != lock)
+    {
+        LM75_OS_Unlock(lock);
+    }
+
+    if (LM75_OK != status)
+    {
+        return LM75_ERROR;
+    }
+
+    dev->temp_raw = LM75_RegUnpack(buf, LM75_TEMP_REG_SIZE);
+
+    if (LM75_OK != LM75_ConvertRaw(dev->temp_raw, ver, &(dev->temp_c)))
+    {
+        dev->temp_c = CONV_ERR;
+        return LM75_ERROR;
     }
 
     return LM75_OK;
 }
 
-/* Enable LM75 shutdown mode */
-LM75_Status LM75_ShutdownEnable(LM75 *dev)
+/* Start reading the temperature in the background, temp_c is updated when xfer becomes LM75_XFER_DONE */
+LM75_Status LM75_GetTemperature_IT(LM75 *dev)
 {
-    uint8_t cfg_reg_value = 0;
+    return LM75_GetTemperature_Async(dev, NULL, NULL);
+}
 
-    if (LM75_OK != read_config(dev, &cfg_reg_value))
+/*
+ * Start reading the temperature in the background, cb is called with ctx when the read ends.
+ * Callable from a completion in interrupt context, so it cannot take the bus lock: a sensor with a
+ * bus lock is read in the background through LM75_GetTemperature_Wait, which holds it.
+ */
+LM75_Status LM75_GetTemperature_Async(LM75 *dev, LM75_Callback cb, void *ctx)
+{
+    if (NULL != dev->cold->lock)
     {
         return LM75_ERROR;
     }
 
-    cfg_reg_value |= SHUTDOWN;
+    return start_read_it(dev, cb, ctx);
+}
+
+/* Read the temperature from a task: hold the bus lock and sleep until the interrupt driven read ends */
+LM75_Status LM75_GetTemperature_Wait(LM75 *dev, uint32_t timeout_ms)
+{
+    LM75_OS_Waiter waiter;
+    LM75_Status status;
 
-    if (LM75_OK != write_config(dev, &cfg_reg_value))
+    LM75_OS_WaiterInit(&waiter);
+    lock_bus(dev);
+
+    status = start_read_it(dev, notify_waiter, &waiter);
+
+    if (LM75_OK == status && !LM75_OS_Wait(&waiter, timeout_ms))
+    {
+        /*
+         * The waiter goes out of scope and the bus is released: stop the transfer first,
+         * so it can neither notify the waiter late nor run into the next owner's transfer.
+         */
+        dev->cold->it.cb = NULL;
+        bus_abort_it(dev);
+        dev->ptr = LM75_PTR_UNKNOWN;
+        dev->xfer = LM75_XFER_IDLE;
+        status = LM75_ERROR;
+    }
+
+    unlock_bus(dev);
+    LM75_OS_WaiterDeinit(&waiter);
+
+    if (LM75_OK == status && LM75_XFER_DONE != dev->xfer)
+    {
+        status = LM75_ERROR;
+    }
+
+    return status;
+}
+
+/* Change the bus lock of an initialised sensor, see LM75_OS_LockInit. Not while the sensor is in use */
+void LM75_SetBusLock(LM75 *dev, LM75_BusLock *lock)
+{
+    dev->cold->lock = lock;
+}
+
+/* Get the integer part of the temperature, rounded down, reading only the MSB of the Temp register */
+LM75_Status LM75_GetTemperatureCoarse(LM75 *dev, int8_t *dest)
+{
+    uint8_t msb = 0;
+
+    if (LM75_OK != read_reg(dev, LM75_TEMP_REG, &msb, sizeof(msb)))
     {
         return LM75_ERROR;
     }
 
+    *dest = (int8_t)msb;
+
     return LM75_OK;
 }
 
+/* Convert a raw Temp, Tos or Thyst register value to degrees celsius */
+LM75_Status LM75_ConvertRaw(uint16_t raw_temp, LM75_Version ver, float *dest)
+{
+    int16_t fixed = 0;
+
+    if (LM75_OK != LM75_ConvertRawFixed(raw_temp, ver, &fixed))
+    {
+        return LM75_ERROR;
+    }
+
+    *dest = fixed / 256.0f;
+
+    return LM75_OK;
+}
+
+/* Enable LM75 shutdown mode */
+LM75_Status LM75_ShutdownEnable(LM75 *dev)
+{
+    return LM75_SetConfiguration(dev, dev->cold->shadow.conf | LM75_CONF_SHUTDOWN);
+}
+
 /* Disable LM75 shutdown mode */
 LM75_Status LM75_ShutdownDisable(LM75 *dev)
 {
-    uint8_t cfg_reg_value = 0;
+    return LM75_SetConfiguration(dev, dev->cold->shadow.conf & ~LM75_CONF_SHUTDOWN);
+}
+
+/* Set value in Conf register, checked and accounted by LM75_WriteRegister */
+LM75_Status LM75_SetConfiguration(LM75 *dev, uint8_t reg_val)
+{
+    return LM75_WriteConf(dev, reg_val);
+}
 
-    if (LM75_OK != read_config(dev, &cfg_reg_value))
+/* Write all fields of the Conf register in a single transfer */
+LM75_Status LM75_SetConfig(LM75 *dev, const LM75_Config *cfg)
+{
+    if (!is_config_valid(cfg))
     {
         return LM75_ERROR;
     }
 
-    cfg_reg_value &= ~(SHUTDOWN);
+    return LM75_SetConfiguration(dev, LM75_CONF_ENCODE(cfg->faults, cfg->polarity, cfg->mode, cfg->shutdown));
+}
+
+/* Decode the cached Conf register value, no bus transfer is made */
+LM75_Status LM75_GetConfig(const LM75 *dev, LM75_Config *cfg)
+{
+    uint8_t conf = dev->cold->shadow.conf;
 
-    if (LM75_OK != write_config(dev, &cfg_reg_value))
+    cfg->faults = (LM75_FaultQueue)(conf & LM75_CONF_FAULTS_MASK);
+    cfg->polarity = (LM75_OsPolarity)(conf & LM75_CONF_POL_MASK);
+    cfg->mode = (LM75_OsMode)(conf & LM75_CONF_MODE_MASK);
+    cfg->shutdown = (0 != LM75_CONF_GET(SHUTDOWN, conf));
+
+    return LM75_OK;
+}
+
+/* Reload the cached Conf register value from the sensor */
+LM75_Status LM75_SyncConfig(LM75 *dev)
+{
+    uint8_t cfg_reg_value = 0;
+
+    if (LM75_OK != LM75_ReadConf(dev, &cfg_reg_value))
     {
         return LM75_ERROR;
     }
 
+    dev->cold->shadow.conf = cfg_reg_value & LM75_CONF_MASK;
+
     return LM75_OK;
 }
 
-/* Set value in Conf register */
-LM75_Status LM75_SetConfiguration(LM75 *dev, uint8_t reg_val)
+/* Read size bytes of a register, prefer the typed accessors generated from the register map */
+LM75_Status LM75_ReadRegister(LM75 *dev, uint8_t reg, uint8_t *dest, uint8_t size)
 {
-    if (LM75_OK != write_config(dev, &reg_val))
+    if (0 == size || size > LM75_REG_MAX_SIZE)
+    {
+        return LM75_ERROR;
+    }
+
+    return read_reg(dev, reg, dest, size);
+}
+
+/*
+ * Write size bytes of a register, the shadow copy is only updated by the typed accessors.
+ * Every Conf write goes through here: invalid values are refused and shutdown changes are accounted.
+ */
+LM75_Status LM75_WriteRegister(LM75 *dev, uint8_t reg, uint8_t *data, uint8_t size)
+{
+    if (0 == size || size > LM75_REG_MAX_SIZE || LM75_TEMP_REG == reg)
+    {
+        return LM75_ERROR;
+    }
+
+    if (LM75_CONF_REG == reg && !LM75_CONF_IS_VALID(data[0]))
+    {
+        return LM75_ERROR;
+    }
+
+    if (LM75_OK != write_reg(dev, reg, data, size))
     {
         return LM75_ERROR;
     }
 
+    if (LM75_CONF_REG == reg && NULL != dev->cold->energy)
+    {
+        LM75_Energy_OnShutdown(dev->cold->energy, 0 != (data[0] & LM75_CONF_SHUTDOWN), LM75_TIMESTAMP());
+    }
+
     return LM75_OK;
-}
\ No newline at end of file
+}
+
+#if defined(LM75_USE_SIM)
+
+/* Interrupt driven reads of simulated sensors need no completion handler */
+
+#elif defined(LM75_USE_LL)
+
+/* Advance the interrupt driven read: pointer byte, repeated START, data bytes, STOP */
+void LM75_IRQHandler(LM75 *dev)
+{
+    I2C_TypeDef *i2c = dev->i2c;
+    LM75_XferCtx *it = &(dev->cold->it);
+
+    if (LL_I2C_IsActiveFlag_BERR(i2c) || LL_I2C_IsActiveFlag_ARLO(i2c) || LL_I2C_IsActiveFlag_OVR(i2c))
+    {
+        LL_I2C_ClearFlag_BERR(i2c);
+        LL_I2C_ClearFlag_ARLO(i2c);
+        LL_I2C_ClearFlag_OVR(i2c);
+        ll_disable_it(i2c);
+        finish_read_it(dev, false);
+        return;
+    }
+
+    if (LL_I2C_IsActiveFlag_NACK(i2c))
+    {
+        /* STOP is generated by hardware, mark the read incomplete and end it on STOPF */
+        LL_I2C_ClearFlag_NACK(i2c);
+        it->idx = 0xFF;
+    }
+
+    if (LM75_XFER_PTR == dev->xfer)
+    {
+        if (LL_I2C_IsActiveFlag_TXIS(i2c))
+        {
+            LL_I2C_TransmitData8(i2c, it->reg);
+        }
+        else if (LL_I2C_IsActiveFlag_TC(i2c))
+        {
+            dev->xfer = LM75_XFER_DATA;
+            LL_I2C_HandleTransfer(i2c, dev->addr, LL_I2C_ADDRSLAVE_7BIT, it->len, LL_I2C_MODE_AUTOEND, LL_I2C_GENERATE_START_READ);
+        }
+    }
+    else if (LM75_XFER_DATA == dev->xfer && LL_I2C_IsActiveFlag_RXNE(i2c))
+    {
+        uint8_t data = LL_I2C_ReceiveData8(i2c);
+
+        if (it->idx < it->len)
+        {
+            it->buf[it->idx++] = data;
+        }
+    }
+
+    if (LL_I2C_IsActiveFlag_STOP(i2c))
+    {
+        LL_I2C_ClearFlag_STOP(i2c);
+        ll_disable_it(i2c);
+        finish_read_it(dev, LM75_XFER_DATA == dev->xfer && it->idx == it->len);
+    }
+}
+
+#else
+
+/* Interrupt driven read finished */
+void LM75_RxCpltCallback(LM75 *dev)
+{
+    dev->cold->it.idx = dev->cold->it.len;
+    finish_read_it(dev, true);
+}
+
+/* Interrupt driven read aborted by the HAL */
+void LM75_ErrorCallback(LM75 *dev)
+{
+    finish_read_it(dev, false);
+}
+
+#endif
@@ -0,0 +1,178 @@
+/*******************************************************
+ * File Name: lm75_cbor.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the CBOR sample encoder.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_cbor.h"
+
+
+/* CBOR major types */
+#define CBOR_UINT           0x00
+#define CBOR_NINT           0x20
+#define CBOR_ARRAY          0x80
+#define CBOR_MAP            0xA0
+#define CBOR_SIMPLE         0xE0
+
+/* Simple value null */
+#define CBOR_NULL           22
+
+
+static LM75_Status put_head(LM75_Cbor *enc, uint8_t major, uint32_t value);
+static LM75_Status put_int(LM75_Cbor *enc, int32_t value);
+
+
+/* Write the head of a data item, the shortest form holding value */
+static LM75_Status put_head(LM75_Cbor *enc, uint8_t major, uint32_t value)
+{
+    uint8_t extra = 0;
+    uint8_t *out = NULL;
+
+    if (value >= 0x10000)
+    {
+        extra = 4;
+    }
+    else if (value >= 0x100)
+    {
+        extra = 2;
+    }
+    else if (value >= 24)
+    {
+        extra = 1;
+    }
+
+    if (enc->overflow || enc->size - enc->len < 1U + extra)
+    {
+        enc->overflow = true;
+        return LM75_ERROR;
+    }
+
+    out = &(enc->buf[enc->len]);
+    enc->len += 1U + extra;
+
+    switch (extra)
+    {
+        case 0:
+            out[0] = (uint8_t)(major | value);
+            break;
+        case 1:
+            out[0] = major | 24;
+            out[1] = (uint8_t)value;
+            break;
+        case 2:
+            out[0] = major | 25;
+            out[1] = (uint8_t)(value >> 8);
+            out[2] = (uint8_t)value;
+            break;
+        default:
+            out[0] = major | 26;
+            out[1] = (uint8_t)(value >> 24);
+            out[2] = (uint8_t)(value >> 16);
+            out[3] = (uint8_t)(value >> 8);
+            out[4] = (uint8_t)value;
+            break;
+    }
+
+    return LM75_OK;
+}
+
+/* Write a signed integer, negative values are stored as -1 - n */
+static LM75_Status put_int(LM75_Cbor *enc, int32_t value)
+{
+    if (value < 0)
+    {
+        return put_head(enc, CBOR_NINT, (uint32_t)(-1 - value));
+    }
+
+    return put_head(enc, CBOR_UINT, (uint32_t)value);
+}
+
+
+/* Initialisation of an encoder writing into buf */
+void LM75_Cbor_Init(LM75_Cbor *enc, uint8_t *buf, uint32_t size)
+{
+    enc->buf = buf;
+    enc->size = size;
+    LM75_Cbor_Reset(enc);
+}
+
+/* Start again at the beginning of the buffer, e.g. once it has been sent */
+void LM75_Cbor_Reset(LM75_Cbor *enc)
+{
+    enc->len = 0;
+    enc->pending = 0;
+    enc->shift = 0;
+    enc->overflow = false;
+}
+
+/* Open a batch of count samples of sensors of version ver, add them with LM75_Cbor_AddRaw */
+LM75_Status LM75_Cbor_BeginBatch(LM75_Cbor *enc, uint32_t timestamp, uint16_t count, LM75_Version ver)
+{
+    uint8_t shift = LM75_VersionShift(ver);
+
+    if (0 != enc->pending || shift > 8)
+    {
+        return LM75_ERROR;
+    }
+
+    if (LM75_OK != put_head(enc, CBOR_MAP, 3) ||
+        LM75_OK != put_head(enc, CBOR_UINT, LM75_CBOR_KEY_TIME) ||
+        LM75_OK != put_head(enc, CBOR_UINT, timestamp) ||
+        LM75_OK != put_head(enc, CBOR_UINT, LM75_CBOR_KEY_EXP) ||
+        LM75_OK != put_int(enc, (int32_t)shift - 8) ||
+        LM75_OK != put_head(enc, CBOR_UINT, LM75_CBOR_KEY_VALUES) ||
+        LM75_OK != put_head(enc, CBOR_ARRAY, count))
+    {
+        return LM75_ERROR;
+    }
+
+    enc->pending = count;
+    enc->shift = shift;
+
+    return LM75_OK;
+}
+
+/* Add the next sample of the open batch from its raw Temp register value */
+LM75_Status LM75_Cbor_AddRaw(LM75_Cbor *enc, uint16_t raw_temp, LM75_Status status)
+{
+    int16_t fixed = (int16_t)(raw_temp & (uint16_t)(0xFFFFU << enc->shift));
+
+    if (0 == enc->pending)
+    {
+        return LM75_ERROR;
+    }
+
+    enc->pending--;
+
+    if (LM75_OK != status)
+    {
+        return put_head(enc, CBOR_SIMPLE, CBOR_NULL);
+    }
+
+    /* Exact, the low bits are cleared */
+    return put_int(enc, fixed / (1 << enc->shift));
+}
+
+/* Encode a whole batch, e.g. the output of LM75_ReadBatchRaw */
+LM75_Status LM75_Cbor_EncodeBatch(LM75_Cbor *enc, uint32_t timestamp, const uint16_t *raw, const LM75_Status *status, uint16_t count, LM75_Version ver)
+{
+    if (LM75_OK != LM75_Cbor_BeginBatch(enc, timestamp, count, ver))
+    {
+        return LM75_ERROR;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (LM75_OK != LM75_Cbor_AddRaw(enc, raw[i], (NULL == status) ? LM75_OK : status[i]))
+        {
+            return LM75_ERROR;
+        }
+    }
+
+    return LM75_OK;
+}
@@ -0,0 +1,87 @@
+/*******************************************************
+ * File Name: lm75_energy.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the LM75 energy and duty-cycle accounting.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_energy.h"
+
+
+/* Start accounting for a sensor, default currents are LM75_I_ACTIVE_NA and LM75_I_SHUTDOWN_NA */
+void LM75_Energy_Attach(LM75_Energy *energy, LM75 *dev, uint32_t bus_hz, uint32_t ts_hz, uint32_t supply_mv)
+{
+    energy->bus_hz = bus_hz;
+    energy->ts_hz = ts_hz;
+    energy->i_active_na = LM75_I_ACTIVE_NA;
+    energy->i_shutdown_na = LM75_I_SHUTDOWN_NA;
+    energy->supply_mv = supply_mv;
+    energy->shutdown = (0 != (dev->cold->shadow.conf & LM75_CONF_SHUTDOWN));
+    energy->since = LM75_TIMESTAMP();
+    energy->active_ticks = 0;
+    energy->shutdown_ticks = 0;
+    energy->bus_bits = 0;
+    energy->transfers = 0;
+
+    dev->cold->energy = energy;
+}
+
+/* Close the time spent in the previous state, called by the driver when the shutdown bit changes */
+void LM75_Energy_OnShutdown(LM75_Energy *energy, bool shutdown, uint32_t now)
+{
+    if (shutdown == energy->shutdown)
+    {
+        return;
+    }
+
+    if (energy->shutdown)
+    {
+        energy->shutdown_ticks += now - energy->since;
+    }
+    else
+    {
+        energy->active_ticks += now - energy->since;
+    }
+
+    energy->shutdown = shutdown;
+    energy->since = now;
+}
+
+/* Account one transfer of bytes bytes (address included) and conditions START/STOP conditions */
+void LM75_Energy_OnTransfer(LM75_Energy *energy, uint16_t bytes, uint8_t conditions)
+{
+    /* 8 data bits and an acknowledge per byte, about one bit time per condition */
+    energy->bus_bits += 9UL * bytes + conditions;
+    energy->transfers++;
+}
+
+/* Accumulated figures up to now */
+void LM75_Energy_Report(const LM75_Energy *energy, uint32_t now, LM75_EnergyReport *report)
+{
+    uint64_t total;
+
+    report->active_ticks = energy->active_ticks;
+    report->shutdown_ticks = energy->shutdown_ticks;
+
+    if (energy->shutdown)
+    {
+        report->shutdown_ticks += now - energy->since;
+    }
+    else
+    {
+        report->active_ticks += now - energy->since;
+    }
+
+    total = report->active_ticks + report->shutdown_ticks;
+    report->duty = (0 == total) ? 0 : (uint16_t)((report->active_ticks * 65535) / total);
+    report->bus_us = (0 == energy->bus_hz) ? 0 : (energy->bus_bits * 1000000) / energy->bus_hz;
+
+    /* nA * mV * s = 1e-6 uJ */
+    report->energy_uj = (0 == energy->ts_hz) ? 0 :
+        (((uint64_t)energy->i_active_na * report->active_ticks + (uint64_t)energy->i_shutdown_na * report->shutdown_ticks) / energy->ts_hz)
+        * energy->supply_mv / 1000000;
+}
@@ -0,0 +1,170 @@
+/*******************************************************
+ * File Name: lm75_eval.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the batch Tos/Thyst evaluation kernel.
+ *              The comparator mode of the LM75 is reproduced: O.S. becomes active after
+ *              queue consecutive readings above Tos and inactive after queue consecutive
+ *              readings below Thyst. SSE2 or AVX2 is used when the compiler targets it.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <string.h>
+
+
+#include "lm75_eval.h"
+
+
+/* Define LM75_EVAL_SCALAR to use the plain C kernel on SIMD targets as well, e.g. to compare them */
+#if defined(LM75_EVAL_SCALAR)
+#define EVAL_LANES          1
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define EVAL_LANES          16
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define EVAL_LANES          8
+#else
+#define EVAL_LANES          1
+#endif
+
+
+static void eval_one(LM75_EvalSet *set, uint32_t i, int16_t temp, uint32_t *rising, uint32_t *falling);
+#if EVAL_LANES > 1
+static void eval_block(LM75_EvalSet *set, uint32_t i, const int16_t *temp, uint32_t *rising, uint32_t *falling);
+#endif
+
+
+/* Evaluate sensor i */
+static void eval_one(LM75_EvalSet *set, uint32_t i, int16_t temp, uint32_t *rising, uint32_t *falling)
+{
+    uint32_t bit = 1UL << (i & 31);
+    uint32_t w = i >> 5;
+    uint8_t active = (0 != (set->active[w] & bit));
+    uint8_t fault = active ? (temp < set->thyst[i]) : (temp > set->tos[i]);
+
+    set->count[i] = fault ? set->count[i] + 1 : 0;
+
+    if (set->count[i] >= set->queue[i])
+    {
+        set->count[i] = 0;
+        set->active[w] ^= bit;
+
+        if (active)
+        {
+            falling[w] |= bit;
+        }
+        else
+        {
+            rising[w] |= bit;
+        }
+    }
+}
+
+#if EVAL_LANES == 16
+
+/* Evaluate sensors i to i + 15, i is a multiple of 16 */
+static void eval_block(LM75_EvalSet *set, uint32_t i, const int16_t *temp, uint32_t *rising, uint32_t *falling)
+{
+    const __m256i bitsel = _mm256_setr_epi16(0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+                                             0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, (int16_t)0x8000);
+    uint32_t w = i >> 5;
+    uint32_t shift = i & 31;
+    uint32_t abits = (set->active[w] >> shift) & 0xFFFF;
+    uint32_t flip;
+
+    __m256i t = _mm256_loadu_si256((const __m256i *)&temp[i]);
+    __m256i tos = _mm256_loadu_si256((const __m256i *)&set->tos[i]);
+    __m256i thyst = _mm256_loadu_si256((const __m256i *)&set->thyst[i]);
+    __m256i cnt = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&set->count[i]));
+    __m256i queue = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&set->queue[i]));
+    __m256i act = _mm256_cmpeq_epi16(_mm256_and_si256(_mm256_set1_epi16((int16_t)abits), bitsel), bitsel);
+
+    /* Above Tos while inactive, below Thyst while active */
+    __m256i fault = _mm256_or_si256(_mm256_and_si256(act, _mm256_cmpgt_epi16(thyst, t)),
+                                    _mm256_andnot_si256(act, _mm256_cmpgt_epi16(t, tos)));
+
+    /* fault lanes are -1: increment the counter, clear it otherwise */
+    cnt = _mm256_and_si256(_mm256_sub_epi16(cnt, fault), fault);
+
+    __m256i flipv = _mm256_cmpgt_epi16(cnt, _mm256_sub_epi16(queue, _mm256_set1_epi16(1)));
+    cnt = _mm256_andnot_si256(flipv, cnt);
+
+    _mm_storeu_si128((__m128i *)&set->count[i], _mm_packus_epi16(_mm256_castsi256_si128(cnt), _mm256_extracti128_si256(cnt, 1)));
+    flip = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(_mm256_castsi256_si128(flipv), _mm256_extracti128_si256(flipv, 1)));
+
+    set->active[w] ^= flip << shift;
+    rising[w] |= (flip & ~abits) << shift;
+    falling[w] |= (flip & abits) << shift;
+}
+
+#elif EVAL_LANES == 8
+
+/* Evaluate sensors i to i + 7, i is a multiple of 8 */
+static void eval_block(LM75_EvalSet *set, uint32_t i, const int16_t *temp, uint32_t *rising, uint32_t *falling)
+{
+    const __m128i bitsel = _mm_setr_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t w = i >> 5;
+    uint32_t shift = i & 31;
+    uint32_t abits = (set->active[w] >> shift) & 0xFF;
+    uint32_t flip;
+
+    __m128i t = _mm_loadu_si128((const __m128i *)&temp[i]);
+    __m128i tos = _mm_loadu_si128((const __m128i *)&set->tos[i]);
+    __m128i thyst = _mm_loadu_si128((const __m128i *)&set->thyst[i]);
+    __m128i cnt = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&set->count[i]), zero);
+    __m128i queue = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&set->queue[i]), zero);
+    __m128i act = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16((int16_t)abits), bitsel), bitsel);
+
+    /* Above Tos while inactive, below Thyst while active */
+    __m128i fault = _mm_or_si128(_mm_and_si128(act, _mm_cmplt_epi16(t, thyst)),
+                                 _mm_andnot_si128(act, _mm_cmpgt_epi16(t, tos)));
+
+    /* fault lanes are -1: increment the counter, clear it otherwise */
+    cnt = _mm_and_si128(_mm_sub_epi16(cnt, fault), fault);
+
+    __m128i flipv = _mm_cmpgt_epi16(cnt, _mm_sub_epi16(queue, _mm_set1_epi16(1)));
+    cnt = _mm_andnot_si128(flipv, cnt);
+
+    _mm_storel_epi64((__m128i *)&set->count[i], _mm_packus_epi16(cnt, zero));
+    flip = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(flipv, zero));
+
+    set->active[w] ^= flip << shift;
+    rising[w] |= (flip & ~abits) << shift;
+    falling[w] |= (flip & abits) << shift;
+}
+
+#endif
+
+
+/* Clear the O.S. state and fault counters of all sensors */
+void LM75_Eval_Reset(LM75_EvalSet *set)
+{
+    memset(set->count, 0, set->n);
+    memset(set->active, 0, LM75_EVAL_WORDS(set->n) * sizeof(uint32_t));
+}
+
+/* Feed one reading per sensor, rising and falling receive the bitmasks of O.S. activations and releases */
+void LM75_Eval(LM75_EvalSet *set, const int16_t *temp, uint32_t *rising, uint32_t *falling)
+{
+    uint32_t i = 0;
+
+    memset(rising, 0, LM75_EVAL_WORDS(set->n) * sizeof(uint32_t));
+    memset(falling, 0, LM75_EVAL_WORDS(set->n) * sizeof(uint32_t));
+
+#if EVAL_LANES > 1
+    for (; i + EVAL_LANES <= set->n; i += EVAL_LANES)
+    {
+        eval_block(set, i, temp, rising, falling);
+    }
+#endif
+
+    for (; i < set->n; i++)
+    {
+        eval_one(set, i, temp[i], rising, falling);
+    }
+}
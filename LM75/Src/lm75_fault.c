@@ -0,0 +1,148 @@
+/*******************************************************
+ * File Name: lm75_fault.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the bus fault injection.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_fault.h"
+
+
+/* Fault set used by the driver, NULL when nothing is injected */
+static LM75_FaultSet *active = NULL;
+
+
+static uint32_t next_random(LM75_FaultSet *set);
+static bool rule_matches(const LM75_FaultRule *rule, uint8_t addr, uint8_t reg, bool write);
+
+
+/* xorshift32, reproducible for a given seed */
+static uint32_t next_random(LM75_FaultSet *set)
+{
+    uint32_t x = set->seed;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    set->seed = x;
+
+    return x;
+}
+
+/* Check that a transfer is selected by a rule */
+static bool rule_matches(const LM75_FaultRule *rule, uint8_t addr, uint8_t reg, bool write)
+{
+    if (LM75_FAULT_ANY != rule->addr && addr != rule->addr)
+    {
+        return false;
+    }
+
+    if (LM75_FAULT_ANY != rule->reg && reg != rule->reg)
+    {
+        return false;
+    }
+
+    if ((LM75_FAULT_DIR_READ == rule->dir && write) || (LM75_FAULT_DIR_WRITE == rule->dir && !write))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+
+/* Initialisation of a fault set, rules keep their order of priority */
+LM75_Status LM75_Fault_Init(LM75_FaultSet *set, LM75_FaultRule *rules, uint16_t count, uint32_t seed)
+{
+    if (0 == seed)
+    {
+        return LM75_ERROR;
+    }
+
+    set->rules = rules;
+    set->count = count;
+    set->seed = seed;
+    set->transfers = 0;
+
+    for (uint8_t i = 0; i < LM75_FAULT_CLASSES; i++)
+    {
+        set->injected[i] = 0;
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        rules[i].script_pos = 0;
+    }
+
+    return LM75_OK;
+}
+
+/* Select the fault set applied to all transfers, NULL to stop injecting */
+void LM75_Fault_Install(LM75_FaultSet *set)
+{
+    active = set;
+}
+
+/* Decide the fault of the next transfer to addr (7-bit) and register reg */
+LM75_FaultClass LM75_Fault_Inject(uint8_t addr, uint8_t reg, bool write)
+{
+    LM75_FaultClass fault = LM75_FAULT_NONE;
+
+    if (NULL == active)
+    {
+        return LM75_FAULT_NONE;
+    }
+
+    active->transfers++;
+
+    for (uint16_t i = 0; i < active->count; i++)
+    {
+        LM75_FaultRule *rule = &(active->rules[i]);
+
+        if (!rule_matches(rule, addr, reg, write))
+        {
+            continue;
+        }
+
+        if (NULL != rule->script)
+        {
+            if (rule->script_pos < rule->script_len)
+            {
+                fault = (LM75_FaultClass)rule->script[rule->script_pos++];
+            }
+        }
+        else if ((next_random(active) & 0xFFFF) < rule->prob || LM75_FAULT_PROB(1.0f) == rule->prob)
+        {
+            fault = (LM75_FaultClass)rule->fault;
+        }
+
+        break;
+    }
+
+    if (fault >= LM75_FAULT_CLASSES)
+    {
+        fault = LM75_FAULT_NONE;
+    }
+
+    active->injected[fault]++;
+
+    return fault;
+}
+
+/* Flip one random bit of the transferred data */
+void LM75_Fault_Corrupt(uint8_t *data, uint16_t size)
+{
+    uint32_t bit = 0;
+
+    if (NULL == active || 0 == size)
+    {
+        return;
+    }
+
+    bit = next_random(active) % (8U * size);
+    data[bit / 8] ^= (uint8_t)(1U << (bit % 8));
+}
@@ -0,0 +1,128 @@
+/*******************************************************
+ * File Name: lm75_health.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the LM75 health tracking.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_health.h"
+
+
+/* Success rate of a sensor which never failed */
+#define FULL_SUCCESS        0xFFFF
+
+
+static int32_t ewma_step(int32_t diff, uint8_t shift);
+static LM75_HealthState evaluate(const LM75_Health *health, uint32_t now);
+
+
+/* Step of a moving average towards a value diff away, rounded away from zero so the average reaches it from both sides */
+static int32_t ewma_step(int32_t diff, uint8_t shift)
+{
+    int32_t round = (int32_t)(1UL << shift) - 1;
+
+    return (diff >= 0) ? (diff + round) >> shift : -((-diff + round) >> shift);
+}
+
+
+/* Worst state matching the current figures */
+static LM75_HealthState evaluate(const LM75_Health *health, uint32_t now)
+{
+    if (now - health->last_good_ts > health->max_age)
+    {
+        return LM75_HEALTH_DEAD;
+    }
+
+    if (health->same >= health->stuck_reads && 0 == health->var)
+    {
+        return LM75_HEALTH_STUCK;
+    }
+
+    if (health->success < health->min_success)
+    {
+        return LM75_HEALTH_DEGRADED;
+    }
+
+    return LM75_HEALTH_OK;
+}
+
+
+/* Initialisation of the health of a sensor, assumed healthy */
+void LM75_Health_Init(LM75_Health *health, uint8_t shift, uint16_t min_success, uint16_t stuck_reads, uint32_t max_age, uint32_t now)
+{
+    health->shift = shift;
+    health->min_success = min_success;
+    health->stuck_reads = stuck_reads;
+    health->max_age = max_age;
+    health->success = FULL_SUCCESS;
+    health->mean = 0;
+    health->var = 0;
+    health->last_raw = 0;
+    health->same = 0;
+    health->last_good_ts = now;
+    health->state = LM75_HEALTH_OK;
+}
+
+/* Account for one read, returns true when the health state changed */
+bool LM75_Health_Update(LM75_Health *health, LM75_Status status, uint16_t raw_temp, uint32_t now)
+{
+    int32_t target = (LM75_OK == status) ? FULL_SUCCESS : 0;
+
+    health->success = (uint16_t)(health->success + ewma_step(target - (int32_t)health->success, health->shift));
+
+    if (LM75_OK == status)
+    {
+        int32_t value = (int16_t)raw_temp;
+        int32_t diff;
+        int32_t incr;
+        int64_t sq;
+
+        if (0 == health->same)
+        {
+            /* First good reading */
+            health->mean = value;
+        }
+
+        diff = value - health->mean;
+        incr = ewma_step(diff, health->shift);
+        sq = ((int64_t)diff * (diff - incr)) >> health->shift;
+
+        /* Exponentially weighted mean and variance, the decay rounds up so a constant input reaches 0 */
+        health->mean += incr;
+        health->var -= (uint32_t)(((uint64_t)health->var + (1UL << health->shift) - 1) >> health->shift);
+        health->var = (uint32_t)((sq > (int64_t)(UINT32_MAX - health->var)) ? UINT32_MAX : health->var + sq);
+
+        if (raw_temp == health->last_raw && health->same < UINT16_MAX)
+        {
+            health->same++;
+        }
+        else if (raw_temp != health->last_raw)
+        {
+            health->same = 1;
+            health->last_raw = raw_temp;
+        }
+
+        health->last_good_ts = now;
+    }
+
+    return LM75_Health_Check(health, now);
+}
+
+/* Re-evaluate the state without a new read, e.g. to age out a silent sensor, returns true on change */
+bool LM75_Health_Check(LM75_Health *health, uint32_t now)
+{
+    LM75_HealthState state = evaluate(health, now);
+
+    if (state == health->state)
+    {
+        return false;
+    }
+
+    health->state = state;
+
+    return true;
+}
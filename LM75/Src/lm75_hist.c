@@ -0,0 +1,150 @@
+/*******************************************************
+ * File Name: lm75_hist.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the raw value temperature histograms.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <string.h>
+
+
+#include "lm75_hist.h"
+
+
+/* Measurement range of the sensor, the lowest bin starts in it */
+#define MAX_TEMP            125
+#define MIN_TEMP            -55
+
+
+static void rescale(LM75_Hist *hist);
+static uint16_t put_varint(uint8_t *dest, uint32_t value);
+
+
+/* Halve all counters so the saturated one can keep counting, rounding down like a halved count rate */
+static void rescale(LM75_Hist *hist)
+{
+    for (uint16_t i = 0; i < hist->nbins; i++)
+    {
+        hist->bins[i] >>= 1;
+    }
+
+    hist->scale++;
+}
+
+/* Write an unsigned LEB128 value, returns its length */
+static uint16_t put_varint(uint8_t *dest, uint32_t value)
+{
+    uint16_t len = 0;
+
+    while (value >= 0x80)
+    {
+        dest[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+
+    dest[len++] = (uint8_t)value;
+
+    return len;
+}
+
+
+/* Initialisation of a histogram of nbins bins starting at low_c, at most LM75_HIST_MAX_BINS, low_c within -55..125 */
+LM75_Status LM75_Hist_Init(LM75_Hist *hist, uint16_t *bins, uint16_t nbins, uint8_t shift, float low_c)
+{
+    if (0 == nbins || nbins > LM75_HIST_MAX_BINS || shift > 15)
+    {
+        return LM75_ERROR;
+    }
+
+    /* Written so that NaN fails too, out of range it would overflow the int16_t conversion below */
+    if (!(low_c >= MIN_TEMP && low_c <= MAX_TEMP))
+    {
+        return LM75_ERROR;
+    }
+
+    hist->bins = bins;
+    hist->nbins = nbins;
+    hist->shift = shift;
+    hist->base = (int16_t)((int16_t)(low_c * 256.0f) >> shift);
+    LM75_Hist_Clear(hist);
+
+    return LM75_OK;
+}
+
+/* Count one raw Temp register value */
+void LM75_Hist_Add(LM75_Hist *hist, uint16_t raw_temp)
+{
+    int32_t idx = ((int16_t)raw_temp >> hist->shift) - hist->base;
+
+    if (idx < 0)
+    {
+        idx = 0;
+    }
+    else if (idx >= hist->nbins)
+    {
+        idx = hist->nbins - 1;
+    }
+
+    /* Halved before counting, so the sample is not lost */
+    if (UINT16_MAX == hist->bins[idx])
+    {
+        rescale(hist);
+    }
+
+    hist->bins[idx]++;
+}
+
+/* Count the temperature read by LM75_GetTemperature, status is its result, nothing is counted unless LM75_OK */
+void LM75_Hist_Update(LM75_Hist *hist, const LM75 *dev, LM75_Status status)
+{
+    if (LM75_OK != status)
+    {
+        return;
+    }
+
+    LM75_Hist_Add(hist, dev->temp_raw);
+}
+
+/* Reset all counters */
+void LM75_Hist_Clear(LM75_Hist *hist)
+{
+    memset(hist->bins, 0, hist->nbins * sizeof(uint16_t));
+    hist->scale = 0;
+}
+
+/*
+ * Write the histogram as: shift, scale, base (int16 LE), nbins (uint16 LE),
+ * then the zigzag LEB128 difference of each counter with the previous one.
+ * Returns the number of bytes written, 0 if size is below LM75_HIST_EXPORT_MAX(nbins).
+ */
+uint16_t LM75_Hist_Export(const LM75_Hist *hist, uint8_t *dest, uint16_t size)
+{
+    uint16_t len = 6;
+    int32_t prev = 0;
+
+    if (size < LM75_HIST_EXPORT_MAX(hist->nbins))
+    {
+        return 0;
+    }
+
+    dest[0] = hist->shift;
+    dest[1] = hist->scale;
+    dest[2] = (uint8_t)hist->base;
+    dest[3] = (uint8_t)((uint16_t)hist->base >> 8);
+    dest[4] = (uint8_t)hist->nbins;
+    dest[5] = (uint8_t)(hist->nbins >> 8);
+
+    for (uint16_t i = 0; i < hist->nbins; i++)
+    {
+        int32_t delta = (int32_t)hist->bins[i] - prev;
+
+        len += put_varint(&dest[len], ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));
+        prev = hist->bins[i];
+    }
+
+    return len;
+}
@@ -0,0 +1,838 @@
+/*******************************************************
+ * File Name: lm75_log.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the compressed columnar sample log.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+/* mmap of the host file mapping in strict C builds */
+#if defined(LM75_LOG_MMAP) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE     200809L
+#endif
+
+
+#include <stddef.h>
+#include <string.h>
+
+
+#include "lm75_log.h"
+
+
+#ifdef LM75_LOG_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+/* Block header fields */
+#define MAGIC_0             'L'
+#define MAGIC_1             '7'
+#define OFS_VERSION         2
+#define OFS_SHIFT           3
+#define OFS_COUNT           4
+#define OFS_TS_LEN          6
+#define OFS_VAL_LEN         8
+#define OFS_FIRST_TS        12
+#define OFS_FIRST_VAL       16
+#define OFS_LAST_TS         20
+#define OFS_MIN             24
+#define OFS_MAX             26
+#define OFS_SUM             28
+
+/* Saved index header: "L7IX", log version, entry size, index format, reserved, count, reserved, size of the indexed log */
+#define INDEX_MAGIC         "L7IX"
+#define OFS_IX_VERSION      4
+#define OFS_IX_ENTRY        5
+#define OFS_IX_FORMAT       6
+#define OFS_IX_COUNT        8
+#define OFS_IX_LOG_SIZE     16
+
+/* Index header layout, format 1 had a 16 byte header holding the low 32 bits of the log size */
+#define INDEX_FORMAT        2
+
+/* Entries passed to the sink per call, their size fits its 32-bit length */
+#define INDEX_CHUNK         ( (uint32_t)(UINT32_MAX / sizeof(LM75_LogIndexEntry)) )
+
+
+/* Alignment of LM75_LogIndexEntry, loaded entries are used in place */
+typedef struct {
+    uint8_t pad;
+    LM75_LogIndexEntry entry;
+} EntryAlign;
+
+#define ENTRY_ALIGN         offsetof(EntryAlign, entry)
+
+
+static void put_le(uint8_t *dest, uint32_t value, uint8_t size);
+static uint32_t get_le(const uint8_t *src, uint8_t size);
+static void put_bits(LM75_LogBits *col, uint32_t value, uint8_t count);
+static bool get_bits(const uint8_t *col, uint32_t len, uint32_t *pos, uint8_t count, uint32_t *value);
+static uint32_t zigzag(int32_t value);
+static int32_t unzigzag(uint32_t value);
+static void put_code(LM75_LogBits *col, uint32_t value, const uint8_t *widths);
+static bool get_code(const uint8_t *col, uint32_t len, uint32_t *pos, const uint8_t *widths, uint32_t *value);
+static int16_t to_steps(uint16_t raw_temp, uint8_t shift);
+static void start_block(LM75_LogWriter *writer);
+static bool load_block(LM75_LogReader *reader);
+static void seek_block(LM75_LogReader *reader, const LM75_LogIndexEntry *entry);
+static void add_sample(LM75_LogAggregate *result, int16_t value);
+
+
+/* Payload widths of the prefix codes 0, 10, 110, 1110 and 1111, a 0 payload after prefix 0 */
+static const uint8_t ts_widths[5] = { 0, 7, 12, 20, 32 };
+static const uint8_t val_widths[5] = { 0, 2, 6, 12, 17 };
+
+
+/* Write a little endian value */
+static void put_le(uint8_t *dest, uint32_t value, uint8_t size)
+{
+    for (uint8_t i = 0; i < size; i++)
+    {
+        dest[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/* Read a little endian value */
+static uint32_t get_le(const uint8_t *src, uint8_t size)
+{
+    uint32_t value = 0;
+
+    for (uint8_t i = size; i > 0; i--)
+    {
+        value = (value << 8) | src[i - 1];
+    }
+
+    return value;
+}
+
+/* Append the count low bits of value, most significant first */
+static void put_bits(LM75_LogBits *col, uint32_t value, uint8_t count)
+{
+    for (uint8_t i = count; i > 0; i--)
+    {
+        uint32_t byte = col->bits / 8;
+        uint8_t mask = (uint8_t)(0x80 >> (col->bits % 8));
+
+        if (0 == col->bits % 8)
+        {
+            col->buf[byte] = 0;
+        }
+
+        if ((value >> (i - 1)) & 1U)
+        {
+            col->buf[byte] |= mask;
+        }
+
+        col->bits++;
+    }
+}
+
+/* Read count bits at pos of a column of len bytes, false past its end */
+static bool get_bits(const uint8_t *col, uint32_t len, uint32_t *pos, uint8_t count, uint32_t *value)
+{
+    uint32_t result = 0;
+
+    if (*pos + count > 8U * len)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        result = (result << 1) | ((col[*pos / 8] >> (7 - *pos % 8)) & 1U);
+        (*pos)++;
+    }
+
+    *value = result;
+
+    return true;
+}
+
+/* Map signed values to unsigned ones, small magnitudes first */
+static uint32_t zigzag(int32_t value)
+{
+    return (value < 0) ? ((uint32_t)(-(value + 1)) << 1) + 1 : (uint32_t)value << 1;
+}
+
+static int32_t unzigzag(uint32_t value)
+{
+    return (value & 1U) ? -(int32_t)(value >> 1) - 1 : (int32_t)(value >> 1);
+}
+
+/* Append value with the shortest prefix code whose range holds it */
+static void put_code(LM75_LogBits *col, uint32_t value, const uint8_t *widths)
+{
+    uint32_t base = 0;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        uint32_t range = 1UL << widths[i];
+
+        if (value - base < range)
+        {
+            /* i ones then a zero, then the offset in the range */
+            put_bits(col, (1UL << (i + 1)) - 2, i + 1);
+            put_bits(col, value - base, widths[i]);
+            return;
+        }
+
+        base += range;
+    }
+
+    put_bits(col, 0x0F, 4);
+    put_bits(col, value, widths[4]);
+}
+
+/* Read a value written by put_code */
+static bool get_code(const uint8_t *col, uint32_t len, uint32_t *pos, const uint8_t *widths, uint32_t *value)
+{
+    uint32_t base = 0;
+    uint32_t bit = 0;
+    uint8_t ones = 0;
+
+    while (ones < 4)
+    {
+        if (!get_bits(col, len, pos, 1, &bit))
+        {
+            return false;
+        }
+
+        if (0 == bit)
+        {
+            break;
+        }
+
+        base += 1UL << widths[ones];
+        ones++;
+    }
+
+    if (4 == ones)
+    {
+        base = 0;
+    }
+
+    if (!get_bits(col, len, pos, widths[ones], value))
+    {
+        return false;
+    }
+
+    *value += base;
+
+    return true;
+}
+
+/* Raw register value in steps of the lowest valid bit */
+static int16_t to_steps(uint16_t raw_temp, uint8_t shift)
+{
+    int16_t fixed = (int16_t)(raw_temp & (uint16_t)(0xFFFFU << shift));
+
+    /* Exact, the low bits are cleared */
+    return (int16_t)(fixed / (1 << shift));
+}
+
+/* Empty the block being built */
+static void start_block(LM75_LogWriter *writer)
+{
+    writer->count = 0;
+    writer->last_delta = 0;
+    writer->ts_col.buf = writer->ts_buf;
+    writer->ts_col.bits = 0;
+    writer->val_col.buf = writer->val_buf;
+    writer->val_col.bits = 0;
+}
+
+/* Parse the next block header of the reader, false at the end of the log */
+static bool load_block(LM75_LogReader *reader)
+{
+    size_t size = 0;
+
+    if (reader->next >= reader->size)
+    {
+        return false;
+    }
+
+    if (LM75_OK != LM75_Log_ParseHeader(&(reader->data[reader->next]), reader->size - reader->next, &(reader->block)))
+    {
+        reader->corrupt = true;
+        return false;
+    }
+
+    size = LM75_LOG_HEADER_SIZE + reader->block.ts_len + reader->block.val_len;
+    reader->ts_col = &(reader->data[reader->next + LM75_LOG_HEADER_SIZE]);
+    reader->val_col = reader->ts_col + reader->block.ts_len;
+    reader->ts_bit = 0;
+    reader->val_bit = 0;
+    reader->index = 0;
+    reader->next += size;
+
+    return true;
+}
+
+/* Move the reader to the start of an indexed block */
+static void seek_block(LM75_LogReader *reader, const LM75_LogIndexEntry *entry)
+{
+    reader->next = (size_t)entry->offset;
+    reader->block.count = 0;
+    reader->index = 0;
+    reader->corrupt = false;
+}
+
+/* Count a decoded sample in an aggregate */
+static void add_sample(LM75_LogAggregate *result, int16_t value)
+{
+    result->count++;
+    result->sum += value;
+
+    if (value < result->min)
+    {
+        result->min = value;
+    }
+
+    if (value > result->max)
+    {
+        result->max = value;
+    }
+}
+
+
+/* Initialisation of a writer of samples of sensors of version ver, finished blocks go to sink */
+LM75_Status LM75_Log_WriterInit(LM75_LogWriter *writer, LM75_Version ver, LM75_LogSink sink, void *ctx)
+{
+    uint8_t shift = LM75_VersionShift(ver);
+
+    if (shift > 15 || NULL == sink)
+    {
+        return LM75_ERROR;
+    }
+
+    writer->sink = sink;
+    writer->ctx = ctx;
+    writer->shift = shift;
+    start_block(writer);
+
+    return LM75_OK;
+}
+
+/* Append a sample, a full block is emitted to the sink */
+LM75_Status LM75_Log_Append(LM75_LogWriter *writer, uint32_t timestamp, uint16_t raw_temp)
+{
+    int16_t val = to_steps(raw_temp, writer->shift);
+
+    if (0 == writer->count)
+    {
+        writer->first_ts = timestamp;
+        writer->first_val = val;
+        writer->min_val = val;
+        writer->max_val = val;
+        writer->sum_val = 0;
+    }
+    else
+    {
+        /* Timestamps wrap modulo 2^32, so do their deltas */
+        int32_t delta = (int32_t)(timestamp - writer->last_ts);
+
+        put_code(&(writer->ts_col), zigzag((int32_t)((uint32_t)delta - (uint32_t)writer->last_delta)), ts_widths);
+        put_code(&(writer->val_col), zigzag(val - writer->last_val), val_widths);
+        writer->last_delta = delta;
+    }
+
+    if (val < writer->min_val)
+    {
+        writer->min_val = val;
+    }
+
+    if (val > writer->max_val)
+    {
+        writer->max_val = val;
+    }
+
+    writer->last_ts = timestamp;
+    writer->last_val = val;
+    writer->sum_val += val;
+    writer->count++;
+
+    if (writer->count >= LM75_LOG_BLOCK_SAMPLES)
+    {
+        return LM75_Log_Flush(writer);
+    }
+
+    return LM75_OK;
+}
+
+/* Emit the block being built even if not full, e.g. before closing the log */
+LM75_Status LM75_Log_Flush(LM75_LogWriter *writer)
+{
+    uint16_t ts_len = (uint16_t)((writer->ts_col.bits + 7) / 8);
+    uint16_t val_len = (uint16_t)((writer->val_col.bits + 7) / 8);
+    uint8_t *header = writer->header;
+    LM75_Status status = LM75_OK;
+
+    if (0 == writer->count)
+    {
+        return LM75_OK;
+    }
+
+    header[0] = MAGIC_0;
+    header[1] = MAGIC_1;
+    header[OFS_VERSION] = LM75_LOG_VERSION;
+    header[OFS_SHIFT] = writer->shift;
+    put_le(&header[OFS_COUNT], writer->count, 2);
+    put_le(&header[OFS_TS_LEN], ts_len, 2);
+    put_le(&header[OFS_VAL_LEN], val_len, 2);
+    put_le(&header[OFS_VAL_LEN + 2], 0, 2);
+    put_le(&header[OFS_FIRST_TS], writer->first_ts, 4);
+    put_le(&header[OFS_FIRST_VAL], (uint16_t)writer->first_val, 2);
+    put_le(&header[OFS_FIRST_VAL + 2], 0, 2);
+    put_le(&header[OFS_LAST_TS], writer->last_ts, 4);
+
+    /* Summary in raw units, the sum of 14000 samples fits 32 bits */
+    put_le(&header[OFS_MIN], (uint16_t)writer->min_val << writer->shift, 2);
+    put_le(&header[OFS_MAX], (uint16_t)writer->max_val << writer->shift, 2);
+    put_le(&header[OFS_SUM], (uint32_t)writer->sum_val << writer->shift, 4);
+
+    if (LM75_OK != writer->sink(writer->ctx, header, LM75_LOG_HEADER_SIZE) ||
+        (ts_len > 0 && LM75_OK != writer->sink(writer->ctx, writer->ts_buf, ts_len)) ||
+        (val_len > 0 && LM75_OK != writer->sink(writer->ctx, writer->val_buf, val_len)))
+    {
+        status = LM75_ERROR;
+    }
+
+    start_block(writer);
+
+    return status;
+}
+
+/* Decode and check a block header, data holds size bytes from the header on */
+LM75_Status LM75_Log_ParseHeader(const uint8_t *data, size_t size, LM75_LogHeader *header)
+{
+    if (size < LM75_LOG_HEADER_SIZE || MAGIC_0 != data[0] || MAGIC_1 != data[1] || LM75_LOG_VERSION != data[OFS_VERSION])
+    {
+        return LM75_ERROR;
+    }
+
+    header->shift = data[OFS_SHIFT];
+    header->count = (uint16_t)get_le(&data[OFS_COUNT], 2);
+    header->ts_len = (uint16_t)get_le(&data[OFS_TS_LEN], 2);
+    header->val_len = (uint16_t)get_le(&data[OFS_VAL_LEN], 2);
+    header->first_ts = get_le(&data[OFS_FIRST_TS], 4);
+    header->first_val = (int16_t)get_le(&data[OFS_FIRST_VAL], 2);
+    header->last_ts = get_le(&data[OFS_LAST_TS], 4);
+    header->min = (int16_t)get_le(&data[OFS_MIN], 2);
+    header->max = (int16_t)get_le(&data[OFS_MAX], 2);
+    header->sum = (int32_t)get_le(&data[OFS_SUM], 4);
+
+    if (header->shift > 15 || 0 == header->count ||
+        size - LM75_LOG_HEADER_SIZE < (uint32_t)header->ts_len + header->val_len)
+    {
+        return LM75_ERROR;
+    }
+
+    return LM75_OK;
+}
+
+/* Initialisation of a reader of the size bytes at data, e.g. a file loaded or mapped in memory */
+void LM75_Log_ReaderInit(LM75_LogReader *reader, const uint8_t *data, size_t size)
+{
+    reader->data = data;
+    reader->size = size;
+    reader->next = 0;
+    reader->block.count = 0;
+    reader->index = 0;
+    reader->corrupt = false;
+}
+
+/* Decode the next sample, false at the end of the log or on corrupt data (see corrupt) */
+bool LM75_Log_Next(LM75_LogReader *reader, uint32_t *timestamp, uint16_t *raw_temp)
+{
+    const LM75_LogHeader *block = &(reader->block);
+
+    if (reader->corrupt || (reader->index >= block->count && !load_block(reader)))
+    {
+        return false;
+    }
+
+    if (0 == reader->index)
+    {
+        reader->ts = block->first_ts;
+        reader->val = block->first_val;
+        reader->delta = 0;
+    }
+    else
+    {
+        uint32_t dod = 0;
+        uint32_t dval = 0;
+
+        if (!get_code(reader->ts_col, block->ts_len, &(reader->ts_bit), ts_widths, &dod) ||
+            !get_code(reader->val_col, block->val_len, &(reader->val_bit), val_widths, &dval))
+        {
+            reader->corrupt = true;
+            return false;
+        }
+
+        reader->delta = (int32_t)((uint32_t)reader->delta + (uint32_t)unzigzag(dod));
+        reader->ts += (uint32_t)reader->delta;
+        reader->val = (int16_t)(reader->val + unzigzag(dval));
+    }
+
+    reader->index++;
+    *timestamp = reader->ts;
+    *raw_temp = (uint16_t)((uint16_t)reader->val << block->shift);
+
+    return true;
+}
+
+/* Skip the rest of the current block, or the whole next one if the current block is done */
+bool LM75_Log_SkipBlock(LM75_LogReader *reader)
+{
+    if (reader->corrupt)
+    {
+        return false;
+    }
+
+    if (reader->index >= reader->block.count && !load_block(reader))
+    {
+        return false;
+    }
+
+    reader->index = reader->block.count;
+
+    return true;
+}
+
+/*
+ * Index the blocks of a log from their headers only, no sample is decoded.
+ * With entries NULL only count is set, to size the array of a second call.
+ */
+LM75_Status LM75_Log_BuildIndex(const uint8_t *data, size_t size, LM75_LogIndexEntry *entries, uint32_t max, uint32_t *count)
+{
+    LM75_LogHeader header;
+    uint64_t samples = 0;
+    size_t offset = 0;
+    uint32_t n = 0;
+
+    while (offset < size)
+    {
+        if (LM75_OK != LM75_Log_ParseHeader(&data[offset], size - offset, &header))
+        {
+            *count = n;
+            return LM75_ERROR;
+        }
+
+        if (NULL != entries)
+        {
+            if (n >= max)
+            {
+                *count = n;
+                return LM75_ERROR;
+            }
+
+            entries[n].offset = offset;
+            entries[n].first_sample = samples;
+            entries[n].first_ts = header.first_ts;
+            entries[n].last_ts = header.last_ts;
+            entries[n].sum = header.sum;
+            entries[n].count = header.count;
+            entries[n].min = header.min;
+            entries[n].max = header.max;
+            entries[n].reserved = 0;
+        }
+
+        samples += header.count;
+        offset += LM75_LOG_HEADER_SIZE + (size_t)header.ts_len + header.val_len;
+        n++;
+    }
+
+    *count = n;
+
+    return LM75_OK;
+}
+
+/* Position the reader so that LM75_Log_Next returns sample number sample, decoding only its block */
+LM75_Status LM75_Log_SeekSample(LM75_LogReader *reader, const LM75_LogIndexEntry *entries, uint32_t count, uint64_t sample)
+{
+    uint32_t low = 0;
+    uint32_t high = count;
+    uint32_t skip = 0;
+    uint32_t ts = 0;
+    uint16_t raw = 0;
+
+    /* Last block starting at or before sample */
+    while (high - low > 1)
+    {
+        uint32_t mid = low + (high - low) / 2;
+
+        if (entries[mid].first_sample <= sample)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if (0 == count || sample < entries[low].first_sample)
+    {
+        return LM75_ERROR;
+    }
+
+    seek_block(reader, &entries[low]);
+
+    for (skip = (uint32_t)(sample - entries[low].first_sample); skip > 0; skip--)
+    {
+        if (!LM75_Log_Next(reader, &ts, &raw))
+        {
+            return LM75_ERROR;
+        }
+    }
+
+    return LM75_OK;
+}
+
+/* Position the reader on the first sample at or after timestamp, timestamps must not wrap within the log */
+LM75_Status LM75_Log_SeekTime(LM75_LogReader *reader, const LM75_LogIndexEntry *entries, uint32_t count, uint32_t timestamp)
+{
+    uint32_t low = 0;
+    uint32_t high = count;
+    uint32_t ts = 0;
+    uint16_t raw = 0;
+
+    /* First block ending at or after timestamp */
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+
+        if (entries[mid].last_ts < timestamp)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if (low >= count)
+    {
+        return LM75_ERROR;
+    }
+
+    seek_block(reader, &entries[low]);
+
+    for (;;)
+    {
+        LM75_LogReader before = *reader;
+
+        if (!LM75_Log_Next(reader, &ts, &raw))
+        {
+            *reader = before;
+            return LM75_ERROR;
+        }
+
+        if (ts >= timestamp)
+        {
+            *reader = before;
+            return LM75_OK;
+        }
+    }
+}
+
+/*
+ * Aggregate the samples with from <= timestamp <= to, timestamps must not wrap within the log.
+ * Blocks inside the range are taken from their summary, only the blocks the range cuts through are decoded.
+ */
+LM75_Status LM75_Log_Aggregate(LM75_LogReader *reader, const LM75_LogIndexEntry *entries, uint32_t count, uint32_t from, uint32_t to, LM75_LogAggregate *result)
+{
+    uint32_t low = 0;
+    uint32_t high = count;
+
+    result->count = 0;
+    result->sum = 0;
+    result->min = INT16_MAX;
+    result->max = INT16_MIN;
+    result->decoded = 0;
+
+    /* First block ending at or after from */
+    while (low < high)
+    {
+        uint32_t mid = low + (high - low) / 2;
+
+        if (entries[mid].last_ts < from)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    for (uint32_t i = low; i < count && entries[i].first_ts <= to; i++)
+    {
+        const LM75_LogIndexEntry *entry = &entries[i];
+        uint32_t ts = 0;
+        uint16_t raw = 0;
+
+        if (entry->first_ts >= from && entry->last_ts <= to)
+        {
+            result->count += entry->count;
+            result->sum += entry->sum;
+
+            if (entry->min < result->min)
+            {
+                result->min = entry->min;
+            }
+
+            if (entry->max > result->max)
+            {
+                result->max = entry->max;
+            }
+
+            continue;
+        }
+
+        seek_block(reader, entry);
+        result->decoded++;
+
+        for (uint16_t k = 0; k < entry->count; k++)
+        {
+            if (!LM75_Log_Next(reader, &ts, &raw))
+            {
+                return LM75_ERROR;
+            }
+
+            if (ts > to)
+            {
+                break;
+            }
+
+            if (ts >= from)
+            {
+                add_sample(result, (int16_t)raw);
+            }
+        }
+    }
+
+    return LM75_OK;
+}
+
+/* Write an index to sink, log_size ties it to the indexed log */
+LM75_Status LM75_Log_SaveIndex(const LM75_LogIndexEntry *entries, uint32_t count, uint64_t log_size, LM75_LogSink sink, void *ctx)
+{
+    uint8_t header[LM75_LOG_INDEX_HEADER_SIZE] = INDEX_MAGIC;
+    const uint8_t *data = (const uint8_t *)entries;
+
+    header[OFS_IX_VERSION] = LM75_LOG_VERSION;
+    header[OFS_IX_ENTRY] = (uint8_t)sizeof(LM75_LogIndexEntry);
+    header[OFS_IX_FORMAT] = INDEX_FORMAT;
+    put_le(&header[OFS_IX_COUNT], count, 4);
+    put_le(&header[OFS_IX_LOG_SIZE], (uint32_t)log_size, 4);
+    put_le(&header[OFS_IX_LOG_SIZE + 4], (uint32_t)(log_size >> 32), 4);
+
+    if (LM75_OK != sink(ctx, header, sizeof(header)))
+    {
+        return LM75_ERROR;
+    }
+
+    /* Sink lengths are 32-bit, an index of more than INDEX_CHUNK entries is written in parts */
+    while (count > 0)
+    {
+        uint32_t n = (count < INDEX_CHUNK) ? count : INDEX_CHUNK;
+
+        if (LM75_OK != sink(ctx, data, n * (uint32_t)sizeof(LM75_LogIndexEntry)))
+        {
+            return LM75_ERROR;
+        }
+
+        data += (size_t)n * sizeof(LM75_LogIndexEntry);
+        count -= n;
+    }
+
+    return LM75_OK;
+}
+
+/*
+ * Use a saved index in place, e.g. from a mapped file, fails if it does not match the log of log_size bytes.
+ * data must be aligned as LM75_LogIndexEntry (8 bytes), as mappings and malloc buffers are.
+ */
+LM75_Status LM75_Log_LoadIndex(const uint8_t *data, size_t size, uint64_t log_size, const LM75_LogIndexEntry **entries, uint32_t *count)
+{
+    uint64_t saved_size = 0;
+    uint32_t n = 0;
+
+    if (0 != (uintptr_t)data % ENTRY_ALIGN || size < LM75_LOG_INDEX_HEADER_SIZE)
+    {
+        return LM75_ERROR;
+    }
+
+    saved_size = ((uint64_t)get_le(&data[OFS_IX_LOG_SIZE + 4], 4) << 32) | get_le(&data[OFS_IX_LOG_SIZE], 4);
+
+    if (0 != memcmp(data, INDEX_MAGIC, 4) ||
+        LM75_LOG_VERSION != data[OFS_IX_VERSION] ||
+        sizeof(LM75_LogIndexEntry) != data[OFS_IX_ENTRY] ||
+        INDEX_FORMAT != data[OFS_IX_FORMAT] ||
+        log_size != saved_size)
+    {
+        return LM75_ERROR;
+    }
+
+    n = get_le(&data[OFS_IX_COUNT], 4);
+
+    if ((size - LM75_LOG_INDEX_HEADER_SIZE) / sizeof(LM75_LogIndexEntry) < n)
+    {
+        return LM75_ERROR;
+    }
+
+    *entries = (const LM75_LogIndexEntry *)&data[LM75_LOG_INDEX_HEADER_SIZE];
+    *count = n;
+
+    return LM75_OK;
+}
+
+#ifdef LM75_LOG_MMAP
+
+/* Map a whole log file read-only */
+LM75_Status LM75_Log_MapFile(const char *path, const uint8_t **data, size_t *size)
+{
+    struct stat st;
+    void *map = NULL;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+    {
+        return LM75_ERROR;
+    }
+
+    if (0 != fstat(fd, &st) || st.st_size <= 0)
+    {
+        close(fd);
+        return LM75_ERROR;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (MAP_FAILED == map)
+    {
+        return LM75_ERROR;
+    }
+
+    *data = (const uint8_t *)map;
+    *size = (size_t)st.st_size;
+
+    return LM75_OK;
+}
+
+/* Release a mapping of LM75_Log_MapFile */
+void LM75_Log_UnmapFile(const uint8_t *data, size_t size)
+{
+    munmap((void *)data, size);
+}
+
+#endif
@@ -0,0 +1,307 @@
+/*******************************************************
+ * File Name: lm75_os.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the ports of the LM75 OS abstraction.
+ *              LM75_OS_Notify may be called from interrupt context.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+/* Priority inheritance mutexes and clock_gettime of the POSIX port in strict C builds */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE     200809L
+#endif
+
+
+#include "lm75_os.h"
+
+
+#if LM75_OS == LM75_OS_FREERTOS
+
+/* Create the bus mutex */
+bool LM75_OS_LockInit(LM75_BusLock *lock)
+{
+    lock->mutex = xSemaphoreCreateMutex();
+
+    return NULL != lock->mutex;
+}
+
+/* Take the bus, a lower priority owner inherits the caller priority */
+void LM75_OS_Lock(LM75_BusLock *lock)
+{
+    xSemaphoreTake(lock->mutex, portMAX_DELAY);
+}
+
+/* Release the bus */
+void LM75_OS_Unlock(LM75_BusLock *lock)
+{
+    xSemaphoreGive(lock->mutex);
+}
+
+/* Bind the waiter to the calling task and drop stale notifications of the driver index */
+void LM75_OS_WaiterInit(LM75_OS_Waiter *waiter)
+{
+    waiter->task = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTakeIndexed(LM75_OS_NOTIFY_INDEX, pdTRUE, 0);
+}
+
+/* Nothing to release */
+void LM75_OS_WaiterDeinit(LM75_OS_Waiter *waiter)
+{
+    (void)waiter;
+}
+
+/* Wake the waiting task */
+void LM75_OS_Notify(LM75_OS_Waiter *waiter)
+{
+    if (xPortIsInsideInterrupt())
+    {
+        BaseType_t woken = pdFALSE;
+
+        vTaskNotifyGiveIndexedFromISR(waiter->task, LM75_OS_NOTIFY_INDEX, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+    else
+    {
+        xTaskNotifyGiveIndexed(waiter->task, LM75_OS_NOTIFY_INDEX);
+    }
+}
+
+/* Block until notified, returns false on timeout */
+bool LM75_OS_Wait(LM75_OS_Waiter *waiter, uint32_t timeout_ms)
+{
+    (void)waiter;
+
+    return 0 != ulTaskNotifyTakeIndexed(LM75_OS_NOTIFY_INDEX, pdTRUE, pdMS_TO_TICKS(timeout_ms));
+}
+
+#elif LM75_OS == LM75_OS_CMSIS2
+
+/* Create the bus mutex */
+bool LM75_OS_LockInit(LM75_BusLock *lock)
+{
+    const osMutexAttr_t attr = { "lm75_bus", osMutexPrioInherit, NULL, 0 };
+
+    lock->mutex = osMutexNew(&attr);
+
+    return NULL != lock->mutex;
+}
+
+/* Take the bus, a lower priority owner inherits the caller priority */
+void LM75_OS_Lock(LM75_BusLock *lock)
+{
+    osMutexAcquire(lock->mutex, osWaitForever);
+}
+
+/* Release the bus */
+void LM75_OS_Unlock(LM75_BusLock *lock)
+{
+    osMutexRelease(lock->mutex);
+}
+
+/* Bind the waiter to the calling thread and drop a stale flag */
+void LM75_OS_WaiterInit(LM75_OS_Waiter *waiter)
+{
+    waiter->thread = osThreadGetId();
+    osThreadFlagsClear(LM75_OS_FLAG);
+}
+
+/* Nothing to release */
+void LM75_OS_WaiterDeinit(LM75_OS_Waiter *waiter)
+{
+    (void)waiter;
+}
+
+/* Wake the waiting thread */
+void LM75_OS_Notify(LM75_OS_Waiter *waiter)
+{
+    osThreadFlagsSet(waiter->thread, LM75_OS_FLAG);
+}
+
+/* Block until notified, returns false on timeout */
+bool LM75_OS_Wait(LM75_OS_Waiter *waiter, uint32_t timeout_ms)
+{
+    uint32_t ticks = (uint32_t)(((uint64_t)timeout_ms * osKernelGetTickFreq() + 999) / 1000);
+    uint32_t flags = osThreadFlagsWait(LM75_OS_FLAG, osFlagsWaitAny, ticks);
+
+    (void)waiter;
+
+    return 0 == (flags & osFlagsError);
+}
+
+#elif LM75_OS == LM75_OS_POSIX
+
+#include <time.h>
+
+/* Create the bus mutex */
+bool LM75_OS_LockInit(LM75_BusLock *lock)
+{
+    pthread_mutexattr_t attr;
+    bool ok;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    ok = (0 == pthread_mutex_init(&lock->mutex, &attr));
+    pthread_mutexattr_destroy(&attr);
+
+    return ok;
+}
+
+/* Take the bus, a lower priority owner inherits the caller priority */
+void LM75_OS_Lock(LM75_BusLock *lock)
+{
+    pthread_mutex_lock(&lock->mutex);
+}
+
+/* Release the bus */
+void LM75_OS_Unlock(LM75_BusLock *lock)
+{
+    pthread_mutex_unlock(&lock->mutex);
+}
+
+/* Prepare the condition the caller will wait on, timed on the monotonic clock so wall clock changes do not move the timeout */
+void LM75_OS_WaiterInit(LM75_OS_Waiter *waiter)
+{
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&waiter->mutex, NULL);
+    pthread_cond_init(&waiter->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    waiter->done = false;
+}
+
+/* Release the condition */
+void LM75_OS_WaiterDeinit(LM75_OS_Waiter *waiter)
+{
+    pthread_cond_destroy(&waiter->cond);
+    pthread_mutex_destroy(&waiter->mutex);
+}
+
+/* Wake the waiting thread */
+void LM75_OS_Notify(LM75_OS_Waiter *waiter)
+{
+    pthread_mutex_lock(&waiter->mutex);
+    waiter->done = true;
+    pthread_cond_signal(&waiter->cond);
+    pthread_mutex_unlock(&waiter->mutex);
+}
+
+/* Block until notified, returns false on timeout */
+bool LM75_OS_Wait(LM75_OS_Waiter *waiter, uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    bool done;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&waiter->mutex);
+
+    while (!waiter->done)
+    {
+        if (0 != pthread_cond_timedwait(&waiter->cond, &waiter->mutex, &deadline))
+        {
+            break;
+        }
+    }
+
+    done = waiter->done;
+    pthread_mutex_unlock(&waiter->mutex);
+
+    return done;
+}
+
+#else
+
+#include "lm75.h"
+
+#ifdef LM75_USE_SIM
+
+#include <time.h>
+
+/* Millisecond clock of the polling wait: the host clock, simulated bus time stands still while polling */
+static uint32_t os_tick_ms(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)((uint64_t)now.tv_sec * 1000U + (uint64_t)now.tv_nsec / 1000000U);
+}
+
+#define OS_TICK_MS()        os_tick_ms()
+
+#else
+
+/* Millisecond clock of the polling wait */
+#define OS_TICK_MS()        HAL_GetTick()
+
+#endif
+
+/* Nothing to create */
+bool LM75_OS_LockInit(LM75_BusLock *lock)
+{
+    (void)lock;
+
+    return true;
+}
+
+/* Single thread of execution, nothing to lock */
+void LM75_OS_Lock(LM75_BusLock *lock)
+{
+    (void)lock;
+}
+
+/* Single thread of execution, nothing to unlock */
+void LM75_OS_Unlock(LM75_BusLock *lock)
+{
+    (void)lock;
+}
+
+/* Clear the completion flag */
+void LM75_OS_WaiterInit(LM75_OS_Waiter *waiter)
+{
+    waiter->done = false;
+}
+
+/* Nothing to release */
+void LM75_OS_WaiterDeinit(LM75_OS_Waiter *waiter)
+{
+    (void)waiter;
+}
+
+/* Set the completion flag */
+void LM75_OS_Notify(LM75_OS_Waiter *waiter)
+{
+    waiter->done = true;
+}
+
+/* Poll the completion flag, returns false on timeout */
+bool LM75_OS_Wait(LM75_OS_Waiter *waiter, uint32_t timeout_ms)
+{
+    uint32_t start = OS_TICK_MS();
+
+    while (!waiter->done)
+    {
+        if (OS_TICK_MS() - start > timeout_ms)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,113 @@
+/*******************************************************
+ * File Name: lm75_oversample.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the oversampling mode.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_oversample.h"
+
+
+static void read_done(LM75 *dev, LM75_Status status, void *ctx);
+
+
+/* Completion callback, called from interrupt context */
+static void read_done(LM75 *dev, LM75_Status status, void *ctx)
+{
+    LM75_Oversample *os = (LM75_Oversample *)ctx;
+    int16_t fixed = 0;
+
+    if (LM75_OK == status && LM75_OK == LM75_ConvertRawFixed(dev->temp_raw, (LM75_Version)dev->ver, &fixed))
+    {
+        os->sum += fixed;
+        os->good++;
+    }
+
+    os->done++;
+    os->busy = false;
+}
+
+
+/* Start averaging count reads of dev spaced by interval, the first one is made on the next poll. Not while a read is in progress */
+LM75_Status LM75_Oversample_Start(LM75_Oversample *os, LM75 *dev, uint16_t count, uint32_t interval, uint32_t now)
+{
+    if (0 == count)
+    {
+        return LM75_ERROR;
+    }
+
+    os->dev = dev;
+    os->count = count;
+    os->interval = interval;
+    os->next = now;
+    os->started = 0;
+    os->done = 0;
+    os->good = 0;
+    os->sum = 0;
+    os->busy = false;
+
+    return LM75_OK;
+}
+
+/* Start the next read when it is due, returns true once all reads have completed */
+bool LM75_Oversample_Poll(LM75_Oversample *os, uint32_t now)
+{
+    if (os->done >= os->count)
+    {
+        return true;
+    }
+
+    if (os->busy || os->started >= os->count || (int32_t)(now - os->next) < 0)
+    {
+        return false;
+    }
+
+    os->busy = true;
+
+    if (LM75_OK != LM75_GetTemperature_Async(os->dev, read_done, os))
+    {
+        /* Sensor busy with another read, try again on the next poll */
+        os->busy = false;
+        return false;
+    }
+
+    /* A poll later than one interval re-anchors the schedule, so the missed reads are not made back to back */
+    if ((int32_t)(now - os->next) >= (int32_t)os->interval)
+    {
+        os->next = now;
+    }
+
+    os->started++;
+    os->next += os->interval;
+
+    return os->done >= os->count;
+}
+
+/*
+ * Mean of the successful reads in 1/256 degree celsius and their number. The sensor truncates
+ * each conversion, so half a step is added to centre the result on the temperature.
+ */
+LM75_Status LM75_Oversample_Result(const LM75_Oversample *os, int16_t *dest, uint16_t *good)
+{
+    int32_t sum = os->sum;
+    int32_t n = os->good;
+    int32_t mean = 0;
+
+    *good = os->good;
+
+    if (os->done < os->count || 0 == n)
+    {
+        return LM75_ERROR;
+    }
+
+    mean = (sum >= 0) ? (sum + n / 2) / n : (sum - n / 2) / n;
+    mean += 1 << (LM75_VersionShift(os->dev->ver) - 1);
+
+    *dest = (int16_t)((mean > INT16_MAX) ? INT16_MAX : mean);
+
+    return LM75_OK;
+}
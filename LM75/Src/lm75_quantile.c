@@ -0,0 +1,354 @@
+/*******************************************************
+ * File Name: lm75_quantile.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the streaming quantile estimator (P2 algorithm,
+ *              Jain and Chlamtac 1985) in fixed point arithmetic.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_quantile.h"
+
+
+/* Number of markers */
+#define MARKERS             5
+
+/* One position unit in the 1/65536 fixed point used for desired positions */
+#define POS_ONE             65536
+
+
+static int64_t desired_increment(uint16_t p, uint8_t i);
+static int32_t parabolic(const LM75_P2 *est, uint8_t i, int32_t s);
+static int32_t linear(const LM75_P2 *est, uint8_t i, int32_t s);
+static uint64_t count_below(const LM75_P2 *est, int32_t x);
+static int32_t merged_value(const LM75_P2 *a, const LM75_P2 *b, uint64_t target, int32_t lo, int32_t hi);
+static void put_u32(uint8_t *dest, uint32_t value);
+static uint32_t get_u32(const uint8_t *src);
+
+
+/* Increment of the desired position of marker i per sample, in 1/65536 */
+static int64_t desired_increment(uint16_t p, uint8_t i)
+{
+    switch (i)
+    {
+    case 1:
+        return p / 2;
+    case 2:
+        return p;
+    case 3:
+        return (POS_ONE + p) / 2;
+    case 4:
+        return POS_ONE;
+    default:
+        return 0;
+    }
+}
+
+/* Piecewise parabolic prediction of marker i moved by s */
+static int32_t parabolic(const LM75_P2 *est, uint8_t i, int32_t s)
+{
+    int64_t left = (int64_t)est->n[i] - est->n[i - 1];
+    int64_t right = (int64_t)est->n[i + 1] - est->n[i];
+    int64_t a = (left + s) * ((int64_t)est->q[i + 1] - est->q[i]) / right;
+    int64_t b = (right - s) * ((int64_t)est->q[i] - est->q[i - 1]) / left;
+
+    return (int32_t)(est->q[i] + s * (a + b) / (left + right));
+}
+
+/* Linear prediction of marker i moved by s */
+static int32_t linear(const LM75_P2 *est, uint8_t i, int32_t s)
+{
+    int64_t dq = (int64_t)est->q[i + s] - est->q[i];
+    int64_t dn = (int64_t)est->n[i + s] - est->n[i];
+
+    return (int32_t)(est->q[i] + s * dq / dn);
+}
+
+/* Approximate number of samples less than or equal to x, in 1/65536 */
+static uint64_t count_below(const LM75_P2 *est, int32_t x)
+{
+    uint8_t j;
+
+    if (est->count < MARKERS)
+    {
+        uint64_t below = 0;
+
+        for (j = 0; j < est->count; j++)
+        {
+            below += (est->q[j] <= x) ? POS_ONE : 0;
+        }
+
+        return below;
+    }
+
+    if (x < est->q[0])
+    {
+        return 0;
+    }
+
+    if (x >= est->q[MARKERS - 1])
+    {
+        return (uint64_t)est->count * POS_ONE;
+    }
+
+    for (j = 0; x >= est->q[j + 1]; j++)
+    {
+    }
+
+    return ((uint64_t)est->n[j] + 1) * POS_ONE +
+           (uint64_t)((int64_t)(x - est->q[j]) * (est->n[j + 1] - est->n[j]) * POS_ONE / ((int64_t)est->q[j + 1] - est->q[j]));
+}
+
+/* Smallest value in [lo, hi] with at least target samples below it in the union of a and b */
+static int32_t merged_value(const LM75_P2 *a, const LM75_P2 *b, uint64_t target, int32_t lo, int32_t hi)
+{
+    while (lo < hi)
+    {
+        int32_t mid = (int32_t)(lo + ((int64_t)hi - lo) / 2);
+
+        if (count_below(a, mid) + count_below(b, mid) >= target)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+
+    return lo;
+}
+
+/* Store a 32-bit value little endian */
+static void put_u32(uint8_t *dest, uint32_t value)
+{
+    dest[0] = (uint8_t)value;
+    dest[1] = (uint8_t)(value >> 8);
+    dest[2] = (uint8_t)(value >> 16);
+    dest[3] = (uint8_t)(value >> 24);
+}
+
+/* Load a 32-bit little endian value */
+static uint32_t get_u32(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+
+/* Initialisation of an estimator of quantile p, see LM75_P2_LEVEL */
+void LM75_P2_Init(LM75_P2 *est, uint16_t p)
+{
+    est->p = p;
+    est->count = 0;
+
+    for (uint8_t i = 0; i < MARKERS; i++)
+    {
+        est->q[i] = 0;
+        est->n[i] = i;
+    }
+}
+
+/* Add one sample in 1/65536 degree celsius */
+void LM75_P2_Add(LM75_P2 *est, int32_t value)
+{
+    uint8_t k;
+
+    if (est->count < MARKERS)
+    {
+        /* Keep the first samples sorted, they become the initial markers */
+        for (k = est->count; k > 0 && est->q[k - 1] > value; k--)
+        {
+            est->q[k] = est->q[k - 1];
+        }
+
+        est->q[k] = value;
+        est->count++;
+        return;
+    }
+
+    if (value < est->q[0])
+    {
+        est->q[0] = value;
+        k = 0;
+    }
+    else if (value >= est->q[MARKERS - 1])
+    {
+        est->q[MARKERS - 1] = value;
+        k = MARKERS - 2;
+    }
+    else
+    {
+        for (k = 0; value >= est->q[k + 1]; k++)
+        {
+        }
+    }
+
+    for (uint8_t i = k + 1; i < MARKERS; i++)
+    {
+        est->n[i]++;
+    }
+
+    est->count++;
+
+    /* Move the middle markers towards their desired position when off by one rank or more */
+    for (uint8_t i = 1; i < MARKERS - 1; i++)
+    {
+        int64_t d = (int64_t)(est->count - 1) * desired_increment(est->p, i) - (int64_t)est->n[i] * POS_ONE;
+
+        if ((d >= POS_ONE && est->n[i + 1] - est->n[i] > 1) ||
+            (d <= -POS_ONE && est->n[i] - est->n[i - 1] > 1))
+        {
+            int32_t s = (d > 0) ? 1 : -1;
+            int32_t qp = parabolic(est, i, s);
+
+            if (est->q[i - 1] < qp && qp < est->q[i + 1])
+            {
+                est->q[i] = qp;
+            }
+            else
+            {
+                est->q[i] = linear(est, i, s);
+            }
+
+            est->n[i] += s;
+        }
+    }
+}
+
+/* Current estimate in 1/65536 degree celsius, 0 without samples */
+int32_t LM75_P2_Get(const LM75_P2 *est)
+{
+    if (0 == est->count)
+    {
+        return 0;
+    }
+
+    if (est->count < MARKERS)
+    {
+        return est->q[(uint32_t)(((uint64_t)(est->count - 1) * est->p + POS_ONE / 2) / POS_ONE)];
+    }
+
+    return est->q[2];
+}
+
+/* Serialise the estimator in LM75_P2_EXPORT_SIZE bytes, little endian */
+void LM75_P2_Export(const LM75_P2 *est, uint8_t *dest)
+{
+    dest[0] = (uint8_t)est->p;
+    dest[1] = (uint8_t)(est->p >> 8);
+    put_u32(&dest[2], est->count);
+
+    for (uint8_t i = 0; i < MARKERS; i++)
+    {
+        put_u32(&dest[6 + 4 * i], (uint32_t)est->q[i]);
+        put_u32(&dest[26 + 4 * i], est->n[i]);
+    }
+}
+
+/* Load an estimator written by LM75_P2_Export */
+LM75_Status LM75_P2_Import(LM75_P2 *est, const uint8_t *src)
+{
+    est->p = (uint16_t)(src[0] | (src[1] << 8));
+    est->count = get_u32(&src[2]);
+
+    for (uint8_t i = 0; i < MARKERS; i++)
+    {
+        est->q[i] = (int32_t)get_u32(&src[6 + 4 * i]);
+        est->n[i] = get_u32(&src[26 + 4 * i]);
+
+        if (i > 0 && est->count >= MARKERS && (est->n[i] <= est->n[i - 1] || est->q[i] < est->q[i - 1]))
+        {
+            return LM75_ERROR;
+        }
+    }
+
+    return LM75_OK;
+}
+
+/* Combine the estimators of two sample sets of the same quantile, dest may alias a or b */
+LM75_Status LM75_P2_Merge(LM75_P2 *dest, const LM75_P2 *a, const LM75_P2 *b)
+{
+    LM75_P2 merged;
+    uint32_t total = a->count + b->count;
+
+    if (a->p != b->p)
+    {
+        return LM75_ERROR;
+    }
+
+    if (a->count < MARKERS || b->count < MARKERS)
+    {
+        /* The smaller side still holds raw samples, replay them */
+        const LM75_P2 *big = (a->count >= b->count) ? a : b;
+        const LM75_P2 *small = (a->count >= b->count) ? b : a;
+        uint32_t small_count = small->count;
+        int32_t samples[MARKERS];
+
+        for (uint8_t i = 0; i < small_count; i++)
+        {
+            samples[i] = small->q[i];
+        }
+
+        *dest = *big;
+
+        for (uint8_t i = 0; i < small_count; i++)
+        {
+            LM75_P2_Add(dest, samples[i]);
+        }
+
+        return LM75_OK;
+    }
+
+    merged.p = a->p;
+    merged.count = total;
+    merged.q[0] = (a->q[0] < b->q[0]) ? a->q[0] : b->q[0];
+    merged.q[MARKERS - 1] = (a->q[MARKERS - 1] > b->q[MARKERS - 1]) ? a->q[MARKERS - 1] : b->q[MARKERS - 1];
+    merged.n[0] = 0;
+    merged.n[MARKERS - 1] = total - 1;
+
+    /* Place the middle markers at their desired ranks and read their height from the combined distribution */
+    for (uint8_t i = 1; i < MARKERS - 1; i++)
+    {
+        uint32_t rank = (uint32_t)(((uint64_t)(total - 1) * desired_increment(merged.p, i) + POS_ONE / 2) / POS_ONE);
+        uint32_t lowest = merged.n[i - 1] + 1;
+        uint32_t highest = total - MARKERS + i;
+
+        merged.n[i] = (rank < lowest) ? lowest : ((rank > highest) ? highest : rank);
+        merged.q[i] = merged_value(a, b, ((uint64_t)merged.n[i] + 1) * POS_ONE, merged.q[0], merged.q[MARKERS - 1]);
+    }
+
+    *dest = merged;
+
+    return LM75_OK;
+}
+
+/* Initialisation of the p50, p95 and p99 estimators of one sensor */
+void LM75_Quantiles_Init(LM75_Quantiles *qs)
+{
+    LM75_P2_Init(&qs->p50, LM75_P2_LEVEL(0.50f));
+    LM75_P2_Init(&qs->p95, LM75_P2_LEVEL(0.95f));
+    LM75_P2_Init(&qs->p99, LM75_P2_LEVEL(0.99f));
+}
+
+/* Add the temperature read by LM75_GetTemperature, status is its result, nothing is added unless LM75_OK */
+LM75_Status LM75_Quantiles_Update(LM75_Quantiles *qs, const LM75 *dev, LM75_Status status)
+{
+    int16_t fixed = 0;
+    int32_t value;
+
+    if (LM75_OK != status || LM75_OK != LM75_ConvertRawFixed(dev->temp_raw, dev->ver, &fixed))
+    {
+        return LM75_ERROR;
+    }
+
+    value = (int32_t)fixed * 256;
+
+    LM75_P2_Add(&qs->p50, value);
+    LM75_P2_Add(&qs->p95, value);
+    LM75_P2_Add(&qs->p99, value);
+
+    return LM75_OK;
+}
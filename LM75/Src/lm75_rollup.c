@@ -0,0 +1,181 @@
+/*******************************************************
+ * File Name: lm75_rollup.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the multi-tier time-series rollups.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_rollup.h"
+
+
+static void clear_bucket(LM75_RollupBucket *bucket, uint32_t start);
+static void merge_bucket(LM75_RollupBucket *dest, const LM75_RollupBucket *src);
+static void roll_tier(LM75_Rollup *rollup, uint8_t index, uint32_t now);
+
+
+/* Empty a bucket for the period starting at start */
+static void clear_bucket(LM75_RollupBucket *bucket, uint32_t start)
+{
+    bucket->start = start;
+    bucket->count = 0;
+    bucket->sum = 0;
+    bucket->min = INT16_MAX;
+    bucket->max = INT16_MIN;
+}
+
+/* Fold the summary of src into dest */
+static void merge_bucket(LM75_RollupBucket *dest, const LM75_RollupBucket *src)
+{
+    dest->count += src->count;
+    dest->sum += src->sum;
+
+    if (src->min < dest->min)
+    {
+        dest->min = src->min;
+    }
+
+    if (src->max > dest->max)
+    {
+        dest->max = src->max;
+    }
+}
+
+/* Close the periods of a tier ended before now, folding the one in progress into the next tier */
+static void roll_tier(LM75_Rollup *rollup, uint8_t index, uint32_t now)
+{
+    LM75_RollupTier *tier = &(rollup->tiers[index]);
+    LM75_RollupBucket *current = &(tier->ring[tier->head]);
+    uint32_t steps = (now - current->start) / tier->period;
+    uint32_t start = current->start + steps * tier->period;
+
+    if (0 == steps)
+    {
+        return;
+    }
+
+    if (index + 1 < rollup->count && 0 != current->count)
+    {
+        LM75_RollupTier *next = &(rollup->tiers[index + 1]);
+
+        merge_bucket(&(next->ring[next->head]), current);
+    }
+
+    /* Periods without samples are kept as empty buckets, at most a whole ring of them */
+    if (steps > tier->len)
+    {
+        steps = tier->len;
+    }
+
+    for (uint32_t i = steps; i > 0; i--)
+    {
+        tier->head = (tier->head + 1 == tier->len) ? 0 : tier->head + 1;
+        clear_bucket(&(tier->ring[tier->head]), start - (i - 1) * tier->period);
+
+        if (tier->filled < tier->len)
+        {
+            tier->filled++;
+        }
+    }
+}
+
+
+/* Give a tier its ring of len buckets and its period */
+void LM75_Rollup_InitTier(LM75_RollupTier *tier, LM75_RollupBucket *ring, uint16_t len, uint32_t period)
+{
+    tier->ring = ring;
+    tier->len = len;
+    tier->head = 0;
+    tier->filled = 0;
+    tier->period = period;
+}
+
+/* Initialisation of the rollups, tiers from the shortest period, periods aligned on multiples of themselves */
+LM75_Status LM75_Rollup_Init(LM75_Rollup *rollup, LM75_RollupTier *tiers, uint8_t count, uint32_t now)
+{
+    if (0 == count)
+    {
+        return LM75_ERROR;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (0 == tiers[i].len || 0 == tiers[i].period)
+        {
+            return LM75_ERROR;
+        }
+
+        if (i > 0 && 0 != tiers[i].period % tiers[i - 1].period)
+        {
+            return LM75_ERROR;
+        }
+
+        tiers[i].head = 0;
+        tiers[i].filled = 1;
+        clear_bucket(&(tiers[i].ring[0]), now - now % tiers[i].period);
+    }
+
+    rollup->tiers = tiers;
+    rollup->count = count;
+
+    return LM75_OK;
+}
+
+/* Add a sample in 1/256 degree celsius taken at now, constant time unless periods were skipped */
+void LM75_Rollup_Add(LM75_Rollup *rollup, int16_t temp_fixed, uint32_t now)
+{
+    LM75_RollupBucket *current = NULL;
+
+    /* Lower tiers first so their closed periods land in the right period of the tier above */
+    for (uint8_t i = 0; i < rollup->count; i++)
+    {
+        roll_tier(rollup, i, now);
+    }
+
+    current = &(rollup->tiers[0].ring[rollup->tiers[0].head]);
+    current->count++;
+    current->sum += temp_fixed;
+
+    if (temp_fixed < current->min)
+    {
+        current->min = temp_fixed;
+    }
+
+    if (temp_fixed > current->max)
+    {
+        current->max = temp_fixed;
+    }
+}
+
+/* Add the last reading of a sensor, call after a successful read */
+void LM75_Rollup_Update(LM75_Rollup *rollup, const LM75 *dev, uint32_t now)
+{
+    int16_t fixed = 0;
+
+    if (LM75_OK == LM75_ConvertRawFixed(dev->temp_raw, (LM75_Version)dev->ver, &fixed))
+    {
+        LM75_Rollup_Add(rollup, fixed, now);
+    }
+}
+
+/*
+ * Copy a bucket of a tier, age 0 is the period in progress, 1 the last closed one, ...
+ * The period in progress of a tier above 0 only holds the closed periods of the tier below.
+ */
+LM75_Status LM75_Rollup_Get(const LM75_Rollup *rollup, uint8_t tier, uint16_t age, LM75_RollupBucket *dest)
+{
+    const LM75_RollupTier *t = NULL;
+
+    if (tier >= rollup->count || age >= rollup->tiers[tier].filled)
+    {
+        return LM75_ERROR;
+    }
+
+    t = &(rollup->tiers[tier]);
+    *dest = t->ring[(t->head + t->len - age) % t->len];
+
+    return LM75_OK;
+}
@@ -0,0 +1,242 @@
+/*******************************************************
+ * File Name: lm75_sampler.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the timer triggered LM75 sampler.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_sampler.h"
+
+
+#ifdef LM75_USE_SIM
+#include "lm75_sim.h"
+#endif
+
+
+/* Timer access of the backend */
+#ifdef LM75_USE_SIM
+#define TIMER_COUNTER(tim)  LM75_Sim_TimerCounter(tim)
+#else
+#define TIMER_COUNTER(tim)  __HAL_TIM_GET_COUNTER(tim)
+#endif
+
+
+static void start_next(LM75_Sampler *smp);
+static void store_result(LM75_Sampler *smp);
+#ifndef LM75_USE_SIM
+static void finish_current(LM75_Sampler *smp);
+#endif
+
+
+/* Launch the read of the sensor at idx, skipping sensors which cannot be started */
+static void start_next(LM75_Sampler *smp)
+{
+    while (smp->idx < smp->count)
+    {
+        LM75_Sample *sample = &smp->samples[smp->idx];
+
+        sample->trigger_ts = smp->trigger_ts;
+        sample->start_delay = TIMER_COUNTER(smp->tim);
+
+        if (LM75_OK == LM75_GetTemperature_IT(&smp->devs[smp->idx]))
+        {
+#ifdef LM75_USE_SIM
+            /* Already completed */
+            store_result(smp);
+            smp->idx++;
+            continue;
+#else
+            return;
+#endif
+        }
+
+        sample->status = LM75_ERROR;
+        smp->idx++;
+    }
+
+    smp->completed++;
+}
+
+/* Store the result of the finished read of the current sensor */
+static void store_result(LM75_Sampler *smp)
+{
+    LM75 *dev = &smp->devs[smp->idx];
+    LM75_Sample *sample = &smp->samples[smp->idx];
+
+    if (LM75_XFER_DONE == dev->xfer)
+    {
+        sample->temp_c = dev->temp_c;
+        sample->status = LM75_OK;
+    }
+    else
+    {
+        sample->status = LM75_ERROR;
+    }
+}
+
+#ifndef LM75_USE_SIM
+
+/* Store the result of the finished read and go on with the next sensor */
+static void finish_current(LM75_Sampler *smp)
+{
+    store_result(smp);
+    smp->idx++;
+    start_next(smp);
+}
+
+#endif
+
+
+/* Initialisation of a new sampler */
+LM75_Status LM75_Sampler_Init(LM75_Sampler *smp, LM75_Timer *htim, LM75 *devs, uint8_t count, LM75_Sample *samples)
+{
+    if (0 == count)
+    {
+        return LM75_ERROR;
+    }
+
+    smp->tim = htim;
+    smp->devs = devs;
+    smp->count = count;
+    smp->samples = samples;
+    smp->idx = count;
+    smp->trigger_ts = 0;
+    smp->triggers = 0;
+    smp->completed = 0;
+    smp->overruns = 0;
+    smp->jitter_min = UINT32_MAX;
+    smp->jitter_max = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        samples[i].trigger_ts = 0;
+        samples[i].start_delay = 0;
+        samples[i].temp_c = 0.0f;
+        samples[i].status = LM75_ERROR;
+    }
+
+    return LM75_OK;
+}
+
+/* Start the sampling timer */
+LM75_Status LM75_Sampler_Start(LM75_Sampler *smp)
+{
+#ifdef LM75_USE_SIM
+    LM75_Sim_TimerStart(smp->tim);
+#else
+    if (HAL_OK != HAL_TIM_Base_Start_IT(smp->tim))
+    {
+        return LM75_ERROR;
+    }
+#endif
+
+    return LM75_OK;
+}
+
+/* Stop the sampling timer, a running sequence is completed */
+LM75_Status LM75_Sampler_Stop(LM75_Sampler *smp)
+{
+#ifdef LM75_USE_SIM
+    LM75_Sim_TimerStop(smp->tim);
+#else
+    if (HAL_OK != HAL_TIM_Base_Stop_IT(smp->tim))
+    {
+        return LM75_ERROR;
+    }
+#endif
+
+    return LM75_OK;
+}
+
+/* Peak to peak start jitter of the first sensor in timer ticks */
+uint32_t LM75_Sampler_GetJitter(const LM75_Sampler *smp)
+{
+    if (smp->jitter_max < smp->jitter_min)
+    {
+        return 0;
+    }
+
+    return smp->jitter_max - smp->jitter_min;
+}
+
+/* Start a new read sequence on the timer update event */
+void LM75_Sampler_TimerCallback(LM75_Sampler *smp)
+{
+    uint32_t delay = TIMER_COUNTER(smp->tim);
+
+    if (smp->idx < smp->count)
+    {
+        smp->overruns++;
+        return;
+    }
+
+    if (delay < smp->jitter_min)
+    {
+        smp->jitter_min = delay;
+    }
+
+    if (delay > smp->jitter_max)
+    {
+        smp->jitter_max = delay;
+    }
+
+    smp->trigger_ts = LM75_TIMESTAMP();
+    smp->triggers++;
+    smp->idx = 0;
+
+    start_next(smp);
+}
+
+#if defined(LM75_USE_SIM)
+
+/* Reads are finished in start_next */
+
+#elif defined(LM75_USE_LL)
+
+/* Advance the read of the current sensor and chain the next one when it ends */
+void LM75_Sampler_IRQHandler(LM75_Sampler *smp)
+{
+    if (smp->idx >= smp->count)
+    {
+        return;
+    }
+
+    LM75_IRQHandler(&smp->devs[smp->idx]);
+
+    if (LM75_XFER_DONE == smp->devs[smp->idx].xfer || LM75_XFER_ERROR == smp->devs[smp->idx].xfer)
+    {
+        finish_current(smp);
+    }
+}
+
+#else
+
+/* Read of the current sensor finished */
+void LM75_Sampler_RxCpltCallback(LM75_Sampler *smp)
+{
+    if (smp->idx >= smp->count)
+    {
+        return;
+    }
+
+    LM75_RxCpltCallback(&smp->devs[smp->idx]);
+    finish_current(smp);
+}
+
+/* Read of the current sensor aborted */
+void LM75_Sampler_ErrorCallback(LM75_Sampler *smp)
+{
+    if (smp->idx >= smp->count)
+    {
+        return;
+    }
+
+    LM75_ErrorCallback(&smp->devs[smp->idx]);
+    finish_current(smp);
+}
+
+#endif
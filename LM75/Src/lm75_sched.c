@@ -0,0 +1,195 @@
+/*******************************************************
+ * File Name: lm75_sched.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the LM75 wake scheduler.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include "lm75_sched.h"
+
+
+static bool is_before_or_at(uint32_t a, uint32_t b);
+static uint32_t next_wake(const LM75_SchedEntry *entries, uint8_t count);
+static bool is_in_window(uint32_t due, const LM75_SchedEntry *entry, uint32_t now);
+static uint32_t advance_due(uint32_t due, const LM75_SchedEntry *entry, uint32_t now);
+
+
+/* Compare timestamps, robust to counter wrap around */
+static bool is_before_or_at(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) <= 0;
+}
+
+/* Latest time at which the most urgent read can still be done, count is at least 1 */
+static uint32_t next_wake(const LM75_SchedEntry *entries, uint8_t count)
+{
+    uint32_t wake = entries[0].due + entries[0].tolerance;
+
+    for (uint8_t i = 1; i < count; i++)
+    {
+        uint32_t latest = entries[i].due + entries[i].tolerance;
+
+        if (is_before_or_at(latest, wake))
+        {
+            wake = latest;
+        }
+    }
+
+    return wake;
+}
+
+/* Check if the read window of the entry has opened */
+static bool is_in_window(uint32_t due, const LM75_SchedEntry *entry, uint32_t now)
+{
+    return is_before_or_at(due - entry->tolerance, now);
+}
+
+/* Move to the next nominal time whose window opens after now, keeping the period grid */
+static uint32_t advance_due(uint32_t due, const LM75_SchedEntry *entry, uint32_t now)
+{
+    do
+    {
+        due += entry->period << entry->backoff;
+    } while (is_in_window(due, entry, now));
+
+    return due;
+}
+
+
+/* Initialisation of a new scheduler */
+LM75_Status LM75_Sched_Init(LM75_Sched *sch, LM75_SchedEntry *entries, uint8_t count, uint32_t now)
+{
+    if (0 == count)
+    {
+        return LM75_ERROR;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        /* Overlapping windows would allow two reads for one period */
+        if (0 == entries[i].period || entries[i].tolerance >= (entries[i].period + 1) / 2)
+        {
+            return LM75_ERROR;
+        }
+
+        /* A longer period shifted by the back-off would leave the signed compare range or wrap to 0 */
+        if (entries[i].period > LM75_SCHED_MAX_PERIOD)
+        {
+            return LM75_ERROR;
+        }
+
+        entries[i].due = now + entries[i].period;
+        entries[i].status = LM75_OK;
+        entries[i].backoff = 0;
+    }
+
+    sch->entries = entries;
+    sch->count = count;
+    sch->wakeups = 0;
+    sch->reads = 0;
+
+    return LM75_OK;
+}
+
+/* Time until which the node can sleep */
+uint32_t LM75_Sched_NextWake(const LM75_Sched *sch)
+{
+    return next_wake(sch->entries, sch->count);
+}
+
+/* Read in one burst every sensor whose window is open at now */
+LM75_Status LM75_Sched_Run(LM75_Sched *sch, uint32_t now)
+{
+    LM75_Status status = LM75_OK;
+    bool woken = false;
+
+    for (uint8_t i = 0; i < sch->count; i++)
+    {
+        LM75_SchedEntry *entry = &sch->entries[i];
+
+        if (!is_in_window(entry->due, entry, now))
+        {
+            continue;
+        }
+
+        entry->status = LM75_GetTemperature(entry->dev);
+
+        if (NULL != entry->health)
+        {
+            LM75_Health_Update(entry->health, entry->status, entry->dev->temp_raw, now);
+
+            /* Unhealthy sensors are read less and less often so they stop eating bus time */
+            if (LM75_HEALTH_OK != entry->health->state)
+            {
+                entry->backoff += (entry->backoff < LM75_SCHED_MAX_BACKOFF) ? 1 : 0;
+            }
+            else
+            {
+                entry->backoff = 0;
+            }
+        }
+
+        entry->due = advance_due(entry->due, entry, now);
+        sch->reads++;
+        woken = true;
+
+        if (LM75_OK != entry->status)
+        {
+            status = LM75_ERROR;
+        }
+    }
+
+    if (woken)
+    {
+        sch->wakeups++;
+    }
+
+    return status;
+}
+
+/* Count wake-ups and reads over the next horizon without touching the bus, reads equals the wake-ups without coalescing */
+LM75_Status LM75_Sched_Plan(const LM75_Sched *sch, uint32_t horizon, uint32_t *wakeups, uint32_t *reads)
+{
+    LM75_SchedEntry plan[LM75_SCHED_MAX_ENTRIES];
+    uint32_t start;
+    uint32_t now;
+
+    *wakeups = 0;
+    *reads = 0;
+
+    if (0 == sch->count || sch->count > LM75_SCHED_MAX_ENTRIES)
+    {
+        return LM75_ERROR;
+    }
+
+    /* Entries are planned on a copy, only their due times change */
+    for (uint8_t i = 0; i < sch->count; i++)
+    {
+        plan[i] = sch->entries[i];
+    }
+
+    start = next_wake(plan, sch->count);
+    now = start;
+
+    while (now - start < horizon)
+    {
+        (*wakeups)++;
+
+        for (uint8_t i = 0; i < sch->count; i++)
+        {
+            if (is_in_window(plan[i].due, &plan[i], now))
+            {
+                plan[i].due = advance_due(plan[i].due, &plan[i], now);
+                (*reads)++;
+            }
+        }
+
+        now = next_wake(plan, sch->count);
+    }
+
+    return LM75_OK;
+}
@@ -0,0 +1,548 @@
+/*******************************************************
+ * File Name: lm75_sim.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the simulated LM75 buses and the host fleet runner.
+ *              Only built with LM75_USE_SIM, needs POSIX threads.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+/* clock_gettime in strict C builds */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE     200809L
+#endif
+
+
+#include "lm75.h"
+
+
+#ifdef LM75_USE_SIM
+
+
+#include <pthread.h>
+#include <time.h>
+
+
+#include "lm75_sim.h"
+
+
+/* Default noise amplitude of a conversion in 1/256 degree celsius */
+#define NOISE               16
+
+/* Default conversion time in microseconds, typical for the LM75 */
+#define CONV_US             100000
+
+
+/* Worker of LM75_Sim_Run, owns the jobs [head, tail) until they are taken or stolen */
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_t thread;
+    uint32_t head;
+    uint32_t tail;
+
+    LM75_SimJob *jobs;
+    void *workers;
+    uint8_t count;
+    uint8_t id;
+
+    uint64_t reads;
+    uint64_t errors;
+    uint32_t stolen;
+} Worker;
+
+
+/* Bus whose time is LM75_TIMESTAMP, the last one initialised unless set with LM75_Sim_SetClock */
+static LM75_Bus *clock_bus = NULL;
+
+
+static LM75_SimDevice *find_device(LM75_Bus *bus, uint8_t addr);
+static void pass(LM75_Bus *bus, uint32_t us);
+static void advance(LM75_Bus *bus, uint16_t bytes, uint8_t conditions);
+static void convert(LM75_Bus *bus, LM75_SimDevice *sdev);
+static LM75_Status read_data(LM75_Bus *bus, LM75_SimDevice *sdev, uint8_t *dest, uint16_t size);
+static bool take_job(Worker *worker, uint32_t *job);
+static bool steal_jobs(Worker *worker);
+static void *run_worker(void *arg);
+static uint64_t host_us(void);
+
+
+/* Sensor acknowledging the 8-bit bus address addr, NULL if none does */
+static LM75_SimDevice *find_device(LM75_Bus *bus, uint8_t addr)
+{
+    for (uint16_t i = 0; i < bus->count; i++)
+    {
+        if (bus->devs[i].addr == (addr >> 1))
+        {
+            return &(bus->devs[i]);
+        }
+    }
+
+    return NULL;
+}
+
+/* Let us microseconds of bus time pass, on both clocks of the bus */
+static void pass(LM75_Bus *bus, uint32_t us)
+{
+    uint32_t sub_us = bus->sub_ms_us + us % 1000U;
+
+    bus->now_us += us;
+    bus->now_ms += us / 1000U + sub_us / 1000U;
+    bus->sub_ms_us = (uint16_t)(sub_us % 1000U);
+}
+
+/* Advance the bus time by the duration of a transfer */
+static void advance(LM75_Bus *bus, uint16_t bytes, uint8_t conditions)
+{
+    uint32_t bits = 9U * bytes + conditions;
+    uint32_t us = (uint32_t)(((uint64_t)bits * 1000000U + bus->bus_hz - 1) / bus->bus_hz);
+
+    bus->transfers++;
+    pass(bus, us);
+
+    if (bus->realtime)
+    {
+        struct timespec wait = { (time_t)(us / 1000000U), (long)(us % 1000000U) * 1000L };
+
+        nanosleep(&wait, NULL);
+    }
+}
+
+/* Move the die temperature along the thermal model, latch a new conversion once the last one ended, unless shut down */
+static void convert(LM75_Bus *bus, LM75_SimDevice *sdev)
+{
+    uint32_t dt_us = bus->now_us - sdev->updated_us;
+    uint32_t tau_us = sdev->tau_ms * 1000U;
+    int32_t target = sdev->ambient + sdev->heating;
+    int32_t noise = 0;
+
+    if (sdev->conf & LM75_CONF_SHUTDOWN)
+    {
+        target = sdev->ambient;
+    }
+
+    if (dt_us >= tau_us)
+    {
+        sdev->temp = target;
+    }
+    else
+    {
+        sdev->temp += (int32_t)(((int64_t)(target - sdev->temp) * dt_us) / tau_us);
+    }
+
+    sdev->updated_us = bus->now_us;
+
+    if ((sdev->conf & LM75_CONF_SHUTDOWN) || bus->now_us - sdev->converted_us < sdev->conv_us)
+    {
+        return;
+    }
+
+    sdev->converted_us = bus->now_us;
+    sdev->seed ^= sdev->seed << 13;
+    sdev->seed ^= sdev->seed >> 17;
+    sdev->seed ^= sdev->seed << 5;
+    noise = (int32_t)(sdev->seed % (2U * sdev->noise + 1)) - (int32_t)sdev->noise;
+
+    sdev->temp_reg = (uint16_t)(int16_t)(sdev->temp + noise) & 0xFFE0;
+}
+
+/* Return the register selected by the pointer register */
+static LM75_Status read_data(LM75_Bus *bus, LM75_SimDevice *sdev, uint8_t *dest, uint16_t size)
+{
+    uint16_t value = 0;
+
+    switch (sdev->ptr)
+    {
+        case LM75_TEMP_REG:
+            convert(bus, sdev);
+            value = sdev->temp_reg;
+            break;
+        case LM75_CONF_REG:
+            value = (uint16_t)(sdev->conf << 8);
+            break;
+        case LM75_THYST_REG:
+            value = sdev->thyst;
+            break;
+        case LM75_TOS_REG:
+            value = sdev->tos;
+            break;
+        default:
+            return LM75_ERROR;
+    }
+
+    /* Registers are sent MSB first, a longer read repeats the last byte like the part */
+    for (uint16_t i = 0; i < size; i++)
+    {
+        dest[i] = (i < 2) ? (uint8_t)(value >> (8 * (1 - i))) : dest[i - 1];
+    }
+
+    return LM75_OK;
+}
+
+/* Take the next job of the worker */
+static bool take_job(Worker *worker, uint32_t *job)
+{
+    bool found = false;
+
+    pthread_mutex_lock(&worker->mutex);
+
+    if (worker->head < worker->tail)
+    {
+        *job = worker->head++;
+        found = true;
+    }
+
+    pthread_mutex_unlock(&worker->mutex);
+
+    return found;
+}
+
+/* Move the last half of the jobs of another worker to this one, false when no work is left */
+static bool steal_jobs(Worker *worker)
+{
+    Worker *workers = (Worker *)worker->workers;
+
+    for (uint8_t i = 1; i < worker->count; i++)
+    {
+        Worker *victim = &(workers[(worker->id + i) % worker->count]);
+        uint32_t head = 0;
+        uint32_t tail = 0;
+
+        pthread_mutex_lock(&victim->mutex);
+
+        if (victim->head < victim->tail)
+        {
+            tail = victim->tail;
+            head = tail - (victim->tail - victim->head + 1) / 2;
+            victim->tail = head;
+        }
+
+        pthread_mutex_unlock(&victim->mutex);
+
+        if (head < tail)
+        {
+            pthread_mutex_lock(&worker->mutex);
+            worker->head = head;
+            worker->tail = tail;
+            pthread_mutex_unlock(&worker->mutex);
+
+            worker->stolen += tail - head;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Run own jobs, then stolen ones, until none is left anywhere */
+static void *run_worker(void *arg)
+{
+    Worker *worker = (Worker *)arg;
+    uint32_t index = 0;
+
+    do
+    {
+        while (take_job(worker, &index))
+        {
+            LM75_SimJob *job = &(worker->jobs[index]);
+
+            for (uint32_t r = 0; r < job->rounds; r++)
+            {
+                for (uint16_t i = 0; i < job->count; i++)
+                {
+                    if (LM75_OK == LM75_GetTemperature(&(job->sensors[i])))
+                    {
+                        job->reads++;
+                    }
+                    else
+                    {
+                        job->errors++;
+                    }
+                }
+            }
+
+            worker->reads += job->reads;
+            worker->errors += job->errors;
+        }
+    } while (steal_jobs(worker));
+
+    return NULL;
+}
+
+/* Microseconds of the host monotonic clock, for the wall time of LM75_Sim_Run */
+static uint64_t host_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000U + (uint64_t)now.tv_nsec / 1000U;
+}
+
+
+/*
+ * Milliseconds of bus time of the clock bus, LM75_TIMESTAMP of simulated builds, so timestamps
+ * follow the same clock as the conversions of the simulated sensors. 0 before any bus exists.
+ */
+uint32_t LM75_Sim_Now(void)
+{
+    return (NULL == clock_bus) ? 0 : clock_bus->now_ms;
+}
+
+/* Make the bus time of bus the LM75_TIMESTAMP clock, for several buses driven from one thread */
+void LM75_Sim_SetClock(LM75_Bus *bus)
+{
+    clock_bus = bus;
+}
+
+/* Initialisation of a simulated sensor at its power-on state, addr is the 7-bit address */
+void LM75_Sim_InitDevice(LM75_SimDevice *sdev, uint8_t addr, float ambient_c, float heating_c, uint32_t tau_ms, uint32_t seed)
+{
+    sdev->addr = addr;
+    sdev->ptr = LM75_TEMP_REG;
+    sdev->conf = 0;
+    sdev->thyst = LM75_LIMIT_ENCODE(75.0f);
+    sdev->tos = LM75_LIMIT_ENCODE(80.0f);
+    sdev->ambient = (int32_t)(ambient_c * 256.0f);
+    sdev->heating = (int32_t)(heating_c * 256.0f);
+    sdev->temp = sdev->ambient;
+    sdev->temp_reg = (uint16_t)(int16_t)sdev->temp & 0xFFE0;
+    sdev->tau_ms = (0 == tau_ms) ? 1 : tau_ms;
+    sdev->updated_us = 0;
+    sdev->conv_us = CONV_US;
+    sdev->converted_us = 0;
+    sdev->noise = NOISE;
+    sdev->seed = (0 == seed) ? 1 : seed;
+}
+
+/* Initialisation of a simulated bus carrying count sensors, its bus time becomes the LM75_TIMESTAMP clock */
+void LM75_Sim_InitBus(LM75_Bus *bus, LM75_SimDevice *devs, uint16_t count, uint32_t bus_hz)
+{
+    bus->devs = devs;
+    bus->count = count;
+    bus->bus_hz = (0 == bus_hz) ? 100000 : bus_hz;
+    bus->now_us = 0;
+    bus->now_ms = 0;
+    bus->sub_ms_us = 0;
+    bus->transfers = 0;
+    bus->nacks = 0;
+    bus->realtime = false;
+    clock_bus = bus;
+}
+
+/* Let us microseconds of bus time pass without any transfer */
+void LM75_Sim_Idle(LM75_Bus *bus, uint32_t us)
+{
+    pass(bus, us);
+}
+
+/* Address byte not acknowledged and STOP, as a transfer to an absent sensor */
+void LM75_Sim_Nack(LM75_Bus *bus)
+{
+    advance(bus, 1, 2);
+    bus->nacks++;
+}
+
+/* Initialisation of a stopped timer with an update event every period_us of the bus time of bus */
+void LM75_Sim_InitTimer(LM75_SimTimer *tim, LM75_Bus *bus, uint32_t period_us)
+{
+    tim->bus = bus;
+    tim->period_us = (0 == period_us) ? 1 : period_us;
+    tim->last_us = bus->now_us;
+    tim->running = false;
+}
+
+/* Start counting from the current bus time */
+void LM75_Sim_TimerStart(LM75_SimTimer *tim)
+{
+    tim->last_us = tim->bus->now_us;
+    tim->running = true;
+}
+
+void LM75_Sim_TimerStop(LM75_SimTimer *tim)
+{
+    tim->running = false;
+}
+
+/* Microseconds since the last update event, the counter of a timer ticking at 1 MHz */
+uint32_t LM75_Sim_TimerCounter(const LM75_SimTimer *tim)
+{
+    return (tim->bus->now_us - tim->last_us) % tim->period_us;
+}
+
+/*
+ * True once per update event due, call from the host loop and run LM75_Sampler_TimerCallback when true.
+ * Events keep their phase, a late poll shows as start delay like a late interrupt.
+ */
+bool LM75_Sim_TimerElapsed(LM75_SimTimer *tim)
+{
+    if (!tim->running || tim->bus->now_us - tim->last_us < tim->period_us)
+    {
+        return false;
+    }
+
+    tim->last_us += tim->period_us;
+
+    return true;
+}
+
+/* Pointer byte followed by data, addr is the 8-bit bus address */
+LM75_Status LM75_Sim_Write(LM75_Bus *bus, uint8_t addr, uint8_t reg, const uint8_t *data, uint16_t size)
+{
+    LM75_SimDevice *sdev = find_device(bus, addr);
+
+    advance(bus, (NULL == sdev) ? 1 : size + 2, 2);
+
+    if (NULL == sdev)
+    {
+        bus->nacks++;
+        return LM75_ERROR;
+    }
+
+    sdev->ptr = reg;
+
+    switch (reg)
+    {
+        case LM75_TEMP_REG:
+            break;
+        case LM75_CONF_REG:
+            if (size >= 1)
+            {
+                convert(bus, sdev);
+                sdev->conf = data[0];
+            }
+            break;
+        case LM75_THYST_REG:
+            if (size >= 2)
+            {
+                sdev->thyst = (uint16_t)((data[0] << 8) | (data[1] & 0x80));
+            }
+            break;
+        case LM75_TOS_REG:
+            if (size >= 2)
+            {
+                sdev->tos = (uint16_t)((data[0] << 8) | (data[1] & 0x80));
+            }
+            break;
+        default:
+            return LM75_ERROR;
+    }
+
+    return LM75_OK;
+}
+
+/* Pointer byte, repeated START and data */
+LM75_Status LM75_Sim_Read(LM75_Bus *bus, uint8_t addr, uint8_t reg, uint8_t *dest, uint16_t size)
+{
+    LM75_SimDevice *sdev = find_device(bus, addr);
+
+    if (NULL == sdev)
+    {
+        advance(bus, 1, 2);
+        bus->nacks++;
+        return LM75_ERROR;
+    }
+
+    advance(bus, size + 3, 3);
+    sdev->ptr = reg;
+
+    return read_data(bus, sdev, dest, size);
+}
+
+/* Data of the register already selected */
+LM75_Status LM75_Sim_Receive(LM75_Bus *bus, uint8_t addr, uint8_t *dest, uint16_t size)
+{
+    LM75_SimDevice *sdev = find_device(bus, addr);
+
+    if (NULL == sdev)
+    {
+        advance(bus, 1, 2);
+        bus->nacks++;
+        return LM75_ERROR;
+    }
+
+    advance(bus, size + 1, 2);
+
+    return read_data(bus, sdev, dest, size);
+}
+
+/*
+ * Run the jobs on threads workers, each starting with a contiguous share of them.
+ * A worker out of jobs steals the last half of the jobs of another one. Every job
+ * must use its own buses, a bus is never shared by two jobs.
+ */
+LM75_Status LM75_Sim_Run(LM75_SimJob *jobs, uint32_t njobs, uint8_t threads, LM75_SimReport *report)
+{
+    Worker workers[LM75_SIM_MAX_THREADS];
+    uint8_t started = 0;
+    uint64_t start_us = 0;
+
+    if (0 == threads || threads > LM75_SIM_MAX_THREADS)
+    {
+        return LM75_ERROR;
+    }
+
+    for (uint8_t i = 0; i < threads; i++)
+    {
+        pthread_mutex_init(&(workers[i].mutex), NULL);
+        workers[i].head = (uint32_t)(((uint64_t)njobs * i) / threads);
+        workers[i].tail = (uint32_t)(((uint64_t)njobs * (i + 1U)) / threads);
+        workers[i].jobs = jobs;
+        workers[i].workers = workers;
+        workers[i].count = threads;
+        workers[i].id = i;
+        workers[i].reads = 0;
+        workers[i].errors = 0;
+        workers[i].stolen = 0;
+    }
+
+    for (uint32_t j = 0; j < njobs; j++)
+    {
+        jobs[j].reads = 0;
+        jobs[j].errors = 0;
+    }
+
+    start_us = host_us();
+
+    for (; started < threads; started++)
+    {
+        if (0 != pthread_create(&(workers[started].thread), NULL, run_worker, &(workers[started])))
+        {
+            break;
+        }
+    }
+
+    /* Jobs of workers that could not be started are stolen by the others */
+    if (0 == started)
+    {
+        run_worker(&(workers[0]));
+    }
+
+    report->reads = 0;
+    report->errors = 0;
+    report->stolen = 0;
+
+    for (uint8_t i = 0; i < threads; i++)
+    {
+        if (i < started)
+        {
+            pthread_join(workers[i].thread, NULL);
+        }
+
+        report->reads += workers[i].reads;
+        report->errors += workers[i].errors;
+        report->stolen += workers[i].stolen;
+        pthread_mutex_destroy(&(workers[i].mutex));
+    }
+
+    report->elapsed_us = host_us() - start_us;
+    report->reads_per_s = (0 == report->elapsed_us) ? 0 : report->reads * 1000000U / report->elapsed_us;
+
+    return LM75_OK;
+}
+
+
+#endif
@@ -0,0 +1,122 @@
+/*******************************************************
+ * File Name: lm75_snapshot.c
+ * Author: Gatsu-Catsu (https://github.com/Gatsu-Catsu )
+ * Creation Date: 2026-10-17
+ * Description: Source file containing the LM75 multi-sensor snapshots.
+ *
+ * License:
+ * The MIT License (MIT)
+ *******************************************************/
+
+
+#include <string.h>
+
+
+#include "lm75_snapshot.h"
+
+
+/* Memory barrier of the host compiler in simulated builds, CMSIS provides it on target */
+#if defined(LM75_USE_SIM) && !defined(__DMB)
+#define __DMB()             __sync_synchronize()
+#endif
+
+
+/* Initialisation of a new snapshot set, no snapshot is published yet */
+LM75_Status LM75_Snapshot_Init(LM75_SnapshotSet *set, LM75 *devs, uint8_t count)
+{
+    if (0 == count || count > LM75_SNAPSHOT_MAX_DEVS)
+    {
+        return LM75_ERROR;
+    }
+
+    memset(set->buf, 0, sizeof(set->buf));
+    set->devs = devs;
+    set->count = count;
+    set->front = 0;
+    set->epoch = 0;
+
+    return LM75_OK;
+}
+
+/* Read all sensors into the back buffer, then publish it as a new epoch */
+LM75_Status LM75_Snapshot_Scan(LM75_SnapshotSet *set)
+{
+    LM75_Status status = LM75_OK;
+    uint8_t back = set->front ^ 1;
+    LM75_Snapshot *snap = &set->buf[back];
+    uint32_t epoch = set->epoch + 1;
+
+    /* Readers still copying this buffer will see the epoch change and retry */
+    snap->epoch = 0;
+    __DMB();
+
+    snap->start_ts = LM75_TIMESTAMP();
+
+    for (uint8_t i = 0; i < set->count; i++)
+    {
+        snap->ok[i] = (LM75_OK == LM75_GetTemperature(&set->devs[i]));
+        snap->raw[i] = snap->ok[i] ? set->devs[i].temp_raw : 0;
+
+        if (!snap->ok[i])
+        {
+            status = LM75_ERROR;
+        }
+    }
+
+    snap->end_ts = LM75_TIMESTAMP();
+
+    /* Epoch 0 marks a snapshot in progress, skip it on wrap around */
+    if (0 == epoch)
+    {
+        epoch = 1;
+    }
+
+    /*
+     * Publish the buffer before the set epoch: a reader that sees set->epoch != 0 always finds
+     * a front buffer with a non-zero epoch, even from an interrupt preempting this scan
+     */
+    __DMB();
+    snap->epoch = epoch;
+    __DMB();
+    set->front = back;
+    __DMB();
+    set->epoch = epoch;
+
+    return status;
+}
+
+/* Copy the latest published snapshot, retrying if a scan overwrote it during the copy */
+LM75_Status LM75_Snapshot_Read(const LM75_SnapshotSet *set, LM75_Snapshot *dest)
+{
+    uint32_t epoch;
+
+    do
+    {
+        const LM75_Snapshot *snap = &set->buf[set->front];
+
+        epoch = snap->epoch;
+
+        if (0 == epoch)
+        {
+            if (0 == set->epoch)
+            {
+                /* Nothing published yet */
+                return LM75_ERROR;
+            }
+
+            /* Buffer was recycled by a newer scan, pick the new front */
+            continue;
+        }
+
+        __DMB();
+        memcpy(dest, (const void *)snap, sizeof(*dest));
+        __DMB();
+
+        if (snap->epoch == epoch)
+        {
+            break;
+        }
+    } while (1);
+
+    return LM75_OK;
+}